@@ -0,0 +1,153 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgCellTemplate.cpp: DgCellTemplate class implementation
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <dglib/DgBoundedIDGG.h>
+#include <dglib/DgBoundedRF2D.h>
+#include <dglib/DgContCartRF.h>
+#include <dglib/DgDiscRF2D.h>
+#include <dglib/DgIDGGBase.h>
+#include <dglib/DgPolygon.h>
+#include "DgCellTemplate.h"
+
+////////////////////////////////////////////////////////////////////////////////
+DgDVec2D
+DgCellTemplate::gridCenter (const DgIDGGBase& dgg, const DgIVec2D& add)
+{
+   DgLocation* loc = dgg.grid2D().makeLocation(add);
+   dgg.ccFrame().convert(loc);
+   DgDVec2D cen = *dgg.ccFrame().getAddress(*loc);
+   delete loc;
+
+   return cen;
+
+} // DgDVec2D DgCellTemplate::gridCenter
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgCellTemplate::gridVertices (const DgIDGGBase& dgg, const DgIVec2D& add,
+                              std::vector<DgDVec2D>& verts)
+{
+   DgPolygon poly;
+   dgg.grid2D().setVertices(add, poly);
+   dgg.ccFrame().convert(poly);
+
+   verts.resize(poly.size());
+   for (int i = 0; i < poly.size(); i++)
+      verts[i] = *dgg.ccFrame().getAddress(poly[i]);
+
+} // void DgCellTemplate::gridVertices
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+DgCellTemplate::setVertices (const DgIVec2D& add,
+                             std::vector<DgDVec2D>& verts) const
+{
+   const int a = (int) (add.i() % period);
+   const int b = (int) (add.j() % period);
+
+   const std::vector<DgDVec2D>& off = offsets_[a][b];
+   if (off.empty()) return false;
+
+   const DgDVec2D cen = cen_[a][b] + di_ * (long double) (add.i() / period)
+                                   + dj_ * (long double) (add.j() / period);
+
+   verts.resize(off.size());
+   for (unsigned int k = 0; k < off.size(); k++)
+      verts[k] = cen + off[k];
+
+   return true;
+
+} // bool DgCellTemplate::setVertices
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgCellTemplate::build (const DgIDGGBase& dgg)
+{
+   valid_ = false;
+
+   const DgBoundedRF2D& bnd2D = dgg.bndRF().bnd2D();
+   const long long int maxI = dgg.maxI();
+   const long long int maxJ = dgg.maxJ();
+
+   // fit the lattice steps over as much of the quad as possible to
+   // minimize the effect of rounding in the prototype centers
+   const long long int mi = std::max(1LL, maxI / period);
+   const long long int mj = std::max(1LL, maxJ / period);
+   const DgDVec2D c0 = gridCenter(dgg, DgIVec2D(0, 0));
+   di_ = (gridCenter(dgg, DgIVec2D(period * mi, 0)) - c0) * (1.0L / mi);
+   dj_ = (gridCenter(dgg, DgIVec2D(0, period * mj)) - c0) * (1.0L / mj);
+
+   std::vector<DgDVec2D> verts;
+   std::vector<DgIVec2D> tests;
+   long double maxOff = 0.0L;
+   for (int a = 0; a < period; a++) {
+      for (int b = 0; b < period; b++) {
+         offsets_[a][b].clear();
+
+         const DgIVec2D add(a, b);
+         if (!bnd2D.validAddressPattern(add)) continue;
+
+         cen_[a][b] = gridCenter(dgg, add);
+         gridVertices(dgg, add, verts);
+         for (const auto& v: verts) {
+            offsets_[a][b].push_back(v - cen_[a][b]);
+            maxOff = std::max(maxOff, std::fabs(v.x() - cen_[a][b].x()));
+            maxOff = std::max(maxOff, std::fabs(v.y() - cen_[a][b].y()));
+         }
+
+         // test cells of this class in the middle and far corner of the quad
+         if (a <= maxI && b <= maxJ) {
+            const long long int ni = (maxI - a) / period;
+            const long long int nj = (maxJ - b) / period;
+            tests.push_back(DgIVec2D(a + period * ni, b + period * nj));
+            tests.push_back(DgIVec2D(a + period * (ni / 2), b + period * (nj / 3)));
+         }
+      }
+   }
+
+   if (tests.empty()) return;
+
+   // verify the template against the grid
+   const long double tol = 1.0E-9L * maxOff;
+   std::vector<DgDVec2D> tmplVerts;
+   for (const auto& add: tests) {
+      gridVertices(dgg, add, verts);
+      if (!setVertices(add, tmplVerts) || verts.size() != tmplVerts.size())
+         return;
+
+      for (unsigned int k = 0; k < verts.size(); k++) {
+         if (std::fabs(verts[k].x() - tmplVerts[k].x()) > tol ||
+             std::fabs(verts[k].y() - tmplVerts[k].y()) > tol)
+            return;
+      }
+   }
+
+   valid_ = true;
+
+} // void DgCellTemplate::build
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgCellTemplate.h: DgCellTemplate class definitions
+//
+// The planar cells of a DGG's quads are translates of a small number of
+// prototype cells: triangle orientations alternate with the parity of j,
+// and class II hexagon addresses follow a pattern with period 3. A template
+// stores a prototype for each address class modulo 6 in the ccFrame along
+// with the lattice steps between centers of the same class, so that the
+// vertices of any cell can be generated without building
+// DgLocation/DgPolygon objects.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DGCELLTEMPLATE_H
+#define DGCELLTEMPLATE_H
+
+#include <vector>
+#include <dglib/DgDVec2D.h>
+#include <dglib/DgIVec2D.h>
+
+class DgIDGGBase;
+
+////////////////////////////////////////////////////////////////////////////////
+class DgCellTemplate {
+
+   public:
+
+      DgCellTemplate (void) : valid_ (false) { }
+
+      // build the template for the grid2D cells of dgg in its ccFrame; the
+      // template is only marked valid if it reproduces the vertices
+      // generated by the grid for a set of test cells
+      void build (const DgIDGGBase& dgg);
+
+      bool isValid (void) const { return valid_; }
+
+      // set verts to the ccFrame vertices of the cell add, which must have
+      // non-negative coordinates; returns false if the template has no
+      // prototype for the class of add
+      bool setVertices (const DgIVec2D& add, std::vector<DgDVec2D>& verts) const;
+
+   private:
+
+      static const int period = 6;
+
+      bool valid_;
+
+      // centers of cells of the class (a, b) are cen_[a][b] + m * di_ + n * dj_
+      // for the cell (a + period * m, b + period * n)
+      DgDVec2D di_;
+      DgDVec2D dj_;
+      DgDVec2D cen_[period][period];
+
+      // prototype vertices relative to the cell center; empty for classes
+      // which contain no valid addresses
+      std::vector<DgDVec2D> offsets_[period][period];
+
+      // the ccFrame center and vertices of add generated by the grid
+      static DgDVec2D gridCenter (const DgIDGGBase& dgg, const DgIVec2D& add);
+      static void gridVertices (const DgIDGGBase& dgg, const DgIVec2D& add,
+                                std::vector<DgDVec2D>& verts);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,224 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgClipRaster.cpp: DgClipRaster class implementation
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include "DgClipRaster.h"
+
+////////////////////////////////////////////////////////////////////////////////
+long long int
+DgClipRaster::colOf (long double x) const
+{
+   long long int c = (long long int) std::floor((x - x0_) / tileSize_);
+   if (c < 0) return 0;
+   if (c >= nx_) return nx_ - 1;
+
+   return c;
+
+} // long long int DgClipRaster::colOf
+
+////////////////////////////////////////////////////////////////////////////////
+long long int
+DgClipRaster::rowOf (long double y) const
+{
+   long long int r = (long long int) std::floor((y - y0_) / tileSize_);
+   if (r < 0) return 0;
+   if (r >= ny_) return ny_ - 1;
+
+   return r;
+
+} // long long int DgClipRaster::rowOf
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgClipRaster::build (const ClipperLib::Paths& paths, ClipperLib::cInt tileSize,
+                     unsigned long int maxTiles)
+{
+   nx_ = ny_ = 0;
+   tiles_.clear();
+
+   // find the bounding box
+   bool empty = true;
+   ClipperLib::cInt minx = 0, miny = 0, maxx = 0, maxy = 0;
+   for (const auto& path: paths) {
+      for (const auto& p: path) {
+         if (empty) {
+            minx = maxx = p.X;
+            miny = maxy = p.Y;
+            empty = false;
+         } else {
+            minx = std::min(minx, p.X);
+            miny = std::min(miny, p.Y);
+            maxx = std::max(maxx, p.X);
+            maxy = std::max(maxy, p.Y);
+         }
+      }
+   }
+
+   if (empty) return;
+
+   // choose the tile size
+   const long double width = (long double) maxx - (long double) minx;
+   const long double height = (long double) maxy - (long double) miny;
+   long double ts = (tileSize < 1) ? 1.0L : (long double) tileSize;
+   while ((std::floor(width / ts) + 1.0L) * (std::floor(height / ts) + 1.0L)
+                 > (long double) maxTiles)
+      ts *= 2.0L;
+
+   x0_ = minx;
+   y0_ = miny;
+   tileSize_ = (ClipperLib::cInt) ts;
+   nx_ = (long long int) std::floor(width / ts) + 1;
+   ny_ = (long long int) std::floor(height / ts) + 1;
+   tiles_.assign(nx_ * ny_, Outside);
+
+   // allow for rounding error in the long double calculations below
+   const long double maxAbs = std::max(
+         std::max(std::fabs((long double) minx), std::fabs((long double) maxx)),
+         std::max(std::fabs((long double) miny), std::fabs((long double) maxy)));
+   const long double margin = 2.0L + 1.0E-12L * maxAbs;
+
+   // mark every tile touched by an edge as a boundary tile
+   for (const auto& path: paths) {
+      const size_t n = path.size();
+      for (size_t i = 0; i < n; i++) {
+         const ClipperLib::IntPoint& p = path[i];
+         const ClipperLib::IntPoint& q = path[(i + 1) % n];
+
+         const long double py = (long double) p.Y;
+         const long double qy = (long double) q.Y;
+         const long double ey0 = std::min(py, qy);
+         const long double ey1 = std::max(py, qy);
+
+         const long long int r0 = rowOf(ey0 - margin);
+         const long long int r1 = rowOf(ey1 + margin);
+         for (long long int r = r0; r <= r1; r++) {
+
+            // the part of the edge within this row
+            const long double ylo =
+                     std::max(ey0, (long double) y0_ + r * ts - margin);
+            const long double yhi =
+                     std::min(ey1, (long double) y0_ + (r + 1) * ts + margin);
+
+            long double xa, xb;
+            if (py == qy) {
+               xa = (long double) p.X;
+               xb = (long double) q.X;
+            } else {
+               const long double dxdy = ((long double) q.X - (long double) p.X)
+                                                                  / (qy - py);
+               xa = (long double) p.X + (ylo - py) * dxdy;
+               xb = (long double) p.X + (yhi - py) * dxdy;
+            }
+            if (xa > xb) std::swap(xa, xb);
+
+            const long long int c0 = colOf(xa - margin);
+            const long long int c1 = colOf(xb + margin);
+            for (long long int c = c0; c <= c1; c++)
+               tile(r, c) = Boundary;
+         }
+      }
+   }
+
+   // classify the remaining tiles by scanning their centers
+   std::vector< std::pair<long double, int> > crossings;
+   for (long long int r = 0; r < ny_; r++) {
+
+      const long double yc = (long double) y0_ + (r + 0.5L) * ts;
+
+      crossings.clear();
+      for (const auto& path: paths) {
+         const size_t n = path.size();
+         for (size_t i = 0; i < n; i++) {
+            const ClipperLib::IntPoint& p = path[i];
+            const ClipperLib::IntPoint& q = path[(i + 1) % n];
+
+            const long double py = (long double) p.Y;
+            const long double qy = (long double) q.Y;
+            if ((py <= yc) == (qy <= yc)) continue;
+
+            const long double x = (long double) p.X + (yc - py) *
+                        ((long double) q.X - (long double) p.X) / (qy - py);
+            crossings.push_back(std::make_pair(x, (qy > py) ? 1 : -1));
+         }
+      }
+
+      std::sort(crossings.begin(), crossings.end());
+
+      int winding = 0;
+      size_t next = 0;
+      for (long long int c = 0; c < nx_; c++) {
+         const long double xc = (long double) x0_ + (c + 0.5L) * ts;
+         while (next < crossings.size() && crossings[next].first < xc)
+            winding += crossings[next++].second;
+
+         if (tile(r, c) != Boundary && winding != 0)
+            tile(r, c) = Inside;
+      }
+   }
+
+} // void DgClipRaster::build
+
+////////////////////////////////////////////////////////////////////////////////
+DgClipRaster::DgTileClass
+DgClipRaster::classify (const ClipperLib::IntPoint& minPt,
+                        const ClipperLib::IntPoint& maxPt) const
+{
+   if (!isBuilt()) return Boundary;
+
+   const ClipperLib::cInt x1 = x0_ + nx_ * tileSize_;
+   const ClipperLib::cInt y1 = y0_ + ny_ * tileSize_;
+
+   // boxes off the raster are outside the polygon
+   if (maxPt.X < x0_ || minPt.X > x1 || maxPt.Y < y0_ || minPt.Y > y1)
+      return Outside;
+
+   bool outside = (minPt.X < x0_ || maxPt.X > x1 ||
+                   minPt.Y < y0_ || maxPt.Y > y1);
+   bool inside = false;
+
+   const long long int c0 = colOf((long double) minPt.X);
+   const long long int c1 = colOf((long double) maxPt.X);
+   const long long int r0 = rowOf((long double) minPt.Y);
+   const long long int r1 = rowOf((long double) maxPt.Y);
+   for (long long int r = r0; r <= r1; r++) {
+      for (long long int c = c0; c <= c1; c++) {
+         const unsigned char t = tile(r, c);
+         if (t == Boundary) return Boundary;
+
+         if (t == Inside)
+            inside = true;
+         else
+            outside = true;
+
+         if (inside && outside) return Boundary;
+      }
+   }
+
+   return (inside) ? Inside : Outside;
+
+} // DgClipRaster::DgTileClass DgClipRaster::classify
+
+////////////////////////////////////////////////////////////////////////////////
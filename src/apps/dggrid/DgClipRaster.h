@@ -0,0 +1,82 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgClipRaster.h: DgClipRaster class definitions
+//
+// A coarse raster over a clipping polygon in clipper integer coordinates.
+// Each square tile is classified as entirely inside the polygon, entirely
+// outside it, or crossed by the polygon boundary, so that cells which fall
+// only on inside or only on outside tiles can be classified without
+// performing a polygon intersection.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DGCLIPRASTER_H
+#define DGCLIPRASTER_H
+
+#include <vector>
+#include "clipper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+class DgClipRaster {
+
+   public:
+
+      enum DgTileClass { Outside = 0, Inside = 1, Boundary = 2 };
+
+      DgClipRaster (void)
+         : x0_ (0), y0_ (0), tileSize_ (0), nx_ (0), ny_ (0) { }
+
+      // build the raster over paths (using the non-zero fill rule) with
+      // tiles of approximately tileSize clipper units; the tile size is
+      // increased as needed to use no more than maxTiles tiles
+      void build (const ClipperLib::Paths& paths, ClipperLib::cInt tileSize,
+                  unsigned long int maxTiles = 1UL << 20);
+
+      bool isBuilt (void) const { return nx_ > 0; }
+
+      // classify the box with the given corners; returns Boundary if the
+      // box can't be classified using the raster alone
+      DgTileClass classify (const ClipperLib::IntPoint& minPt,
+                            const ClipperLib::IntPoint& maxPt) const;
+
+   private:
+
+      ClipperLib::cInt x0_;       // lower left corner of the raster
+      ClipperLib::cInt y0_;
+      ClipperLib::cInt tileSize_;
+      long long int nx_;          // number of tile columns
+      long long int ny_;          // number of tile rows
+
+      std::vector<unsigned char> tiles_; // row-major tile classes
+
+      unsigned char& tile (long long int r, long long int c)
+                        { return tiles_[r * nx_ + c]; }
+      unsigned char tile (long long int r, long long int c) const
+                        { return tiles_[r * nx_ + c]; }
+
+      // clamped tile column/row containing the coordinate
+      long long int colOf (long double x) const;
+      long long int rowOf (long double y) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
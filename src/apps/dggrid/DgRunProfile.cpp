@@ -0,0 +1,172 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgRunProfile.cpp: DgRunProfile class implementation
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <ctime>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include <dglib/DgString.h>
+
+#include "DgRunProfile.h"
+
+bool DgRunProfile::enabled_ = false;
+std::atomic<long long int> DgRunProfile::calls_[DgRunProfile::NumPhases];
+std::atomic<long long int> DgRunProfile::nanos_[DgRunProfile::NumPhases];
+std::atomic<long long int> DgRunProfile::cpuNanos_[DgRunProfile::NumPhases];
+
+////////////////////////////////////////////////////////////////////////////////
+const char*
+DgRunProfile::phaseName (DgPhase phase)
+{
+   switch (phase) {
+      case GridConstruction: return "grid_construction";
+      case ClipRegions:      return "clip_regions";
+      case CandidateEval:    return "candidate_evaluation";
+      case ClipperCalls:     return "clipper_intersection";
+      case HoleTests:        return "hole_tests";
+      case Projection:       return "projection";
+      case Vertices:         return "vertex_generation";
+      case BinPoints:        return "bin_points";
+      case OutTotal:         return "output_total";
+      case OutData:          return "output_data";
+      case OutCell:          return "output_cell";
+      case OutPoint:         return "output_point";
+      case OutRandPts:       return "output_random_points";
+      case OutNeighbors:     return "output_neighbors";
+      case OutChildren:      return "output_children";
+      case OutNdxParent:     return "output_index_parent";
+      case OutNdxChildren:   return "output_index_children";
+      case OutCollection:    return "output_collection";
+      case NumPhases:        break;
+   }
+
+   return "unknown";
+
+} // const char* DgRunProfile::phaseName
+
+////////////////////////////////////////////////////////////////////////////////
+long long int
+DgRunProfile::threadCpuNanos (void)
+{
+#ifdef _WIN32
+   return (long long int) std::clock() * (1000000000LL / CLOCKS_PER_SEC);
+#else
+   struct timespec ts;
+   if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+      return 0;
+
+   return (long long int) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+
+} // long long int DgRunProfile::threadCpuNanos
+
+////////////////////////////////////////////////////////////////////////////////
+unsigned long long int
+DgRunProfile::peakRSS (void)
+{
+#ifdef _WIN32
+   return 0;
+#else
+   struct rusage usage;
+   if (getrusage(RUSAGE_SELF, &usage) != 0)
+      return 0;
+
+#ifdef __APPLE__
+   return (unsigned long long int) usage.ru_maxrss; // bytes
+#else
+   return (unsigned long long int) usage.ru_maxrss * 1024ULL; // kilobytes
+#endif
+#endif
+
+} // unsigned long long int DgRunProfile::peakRSS
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+DgRunProfile::writeReport (const std::string& fileName,
+                           const DgRunTotals& totals)
+{
+   std::ofstream out(fileName.c_str());
+   if (!out.good())
+      return false;
+
+   const char* fmt = "%.6Lf";
+   const double cpuSecs = (double) std::clock() / CLOCKS_PER_SEC;
+   const double cellsPerSec = (totals.wallSecs > 0.0)
+                     ? totals.nCellsAccepted / totals.wallSecs : 0.0;
+   const double testedPerSec = (totals.wallSecs > 0.0)
+                     ? totals.nCellsTested / totals.wallSecs : 0.0;
+
+   // every cell written goes through one output_total scope
+   const long long int nCellsOutput = calls_[OutTotal].load();
+   const double outputPerSec = (totals.wallSecs > 0.0)
+                     ? nCellsOutput / totals.wallSecs : 0.0;
+
+   out << "{\n";
+   out << "  \"operation\": \"" << totals.operation << "\",\n";
+   out << "  \"wall_seconds\": "
+       << dgg::util::to_string(totals.wallSecs, fmt) << ",\n";
+   out << "  \"cpu_seconds\": " << dgg::util::to_string(cpuSecs, fmt) << ",\n";
+   out << "  \"startup_seconds\": "
+       << dgg::util::to_string(totals.startupSecs, fmt) << ",\n";
+   out << "  \"cells_tested\": " << totals.nCellsTested << ",\n";
+   out << "  \"cells_accepted\": " << totals.nCellsAccepted << ",\n";
+   out << "  \"cells_tested_per_second\": "
+       << dgg::util::to_string(testedPerSec, "%.1Lf") << ",\n";
+   out << "  \"cells_accepted_per_second\": "
+       << dgg::util::to_string(cellsPerSec, "%.1Lf") << ",\n";
+   out << "  \"cells_output\": " << nCellsOutput << ",\n";
+   out << "  \"cells_output_per_second\": "
+       << dgg::util::to_string(outputPerSec, "%.1Lf") << ",\n";
+   out << "  \"peak_rss_bytes\": " << peakRSS() << ",\n";
+   out << "  \"phases\": {";
+
+   bool first = true;
+   for (int p = 0; p < NumPhases; p++) {
+      const long long int calls = calls_[p].load();
+      if (!calls) continue;
+
+      const double secs = nanos_[p].load() / 1.0e9;
+      out << (first ? "\n" : ",\n");
+      first = false;
+      out << "    \"" << phaseName((DgPhase) p) << "\": { \"count\": " << calls
+          << ", \"wall_seconds\": " << dgg::util::to_string(secs, "%.9Lf")
+          << ", \"cpu_seconds\": "
+          << dgg::util::to_string(cpuNanos_[p].load() / 1.0e9, "%.9Lf");
+      if (secs > 0.0)
+         out << ", \"per_second\": "
+             << dgg::util::to_string(calls / secs, "%.1Lf");
+      out << " }";
+   }
+   out << (first ? "}\n" : "\n  }\n");
+   out << "}\n";
+
+   return out.good();
+
+} // bool DgRunProfile::writeReport
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
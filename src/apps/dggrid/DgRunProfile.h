@@ -0,0 +1,138 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgRunProfile.h: DgRunProfile and DgProfileScope class definitions
+//
+// Per-phase timers and counters for a dggrid run. Profiling is off unless
+// the profile_output_file parameter is set, in which case a JSON report is
+// written at the end of the run. A DgProfileScope on a disabled profile
+// costs a single test.
+//
+// Phases nest (vertex generation happens inside candidate evaluation, for
+// example), so phase times are not additive. Wall and CPU times are both
+// summed over all threads; CPU times are the CPU time of the thread running
+// the phase (process CPU time on Windows).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DGRUNPROFILE_H
+#define DGRUNPROFILE_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+class DgRunProfile {
+
+   public:
+
+      enum DgPhase { GridConstruction, ClipRegions, CandidateEval,
+                     ClipperCalls, HoleTests, Projection, Vertices, BinPoints,
+                     OutTotal, OutData, OutCell, OutPoint, OutRandPts, OutNeighbors,
+                     OutChildren, OutNdxParent, OutNdxChildren, OutCollection,
+                     NumPhases };
+
+      // run-level values included in the report
+      struct DgRunTotals {
+         std::string operation;
+         double wallSecs;
+         double startupSecs;
+         unsigned long long int nCellsTested;
+         unsigned long long int nCellsAccepted;
+      };
+
+      // must be set before any worker threads are started
+      static bool enabled (void) { return enabled_; }
+      static void setEnabled (bool enabledIn = true) { enabled_ = enabledIn; }
+
+      static void record (DgPhase phase, long long int nanos,
+                          long long int cpuNanos, long long int count = 1)
+      {
+         calls_[phase].fetch_add(count, std::memory_order_relaxed);
+         nanos_[phase].fetch_add(nanos, std::memory_order_relaxed);
+         cpuNanos_[phase].fetch_add(cpuNanos, std::memory_order_relaxed);
+      }
+
+      // CPU time used so far by the calling thread
+      static long long int threadCpuNanos (void);
+
+      static const char* phaseName (DgPhase phase);
+
+      // peak resident set size in bytes; 0 if not available
+      static unsigned long long int peakRSS (void);
+
+      // returns false if the file could not be written
+      static bool writeReport (const std::string& fileName,
+                               const DgRunTotals& totals);
+
+   private:
+
+      static bool enabled_;
+      static std::atomic<long long int> calls_[NumPhases];
+      static std::atomic<long long int> nanos_[NumPhases];
+      static std::atomic<long long int> cpuNanos_[NumPhases];
+};
+
+////////////////////////////////////////////////////////////////////////////////
+class DgProfileScope {
+
+   public:
+
+      DgProfileScope (DgRunProfile::DgPhase phase)
+         : phase_ (phase), on_ (DgRunProfile::enabled()), count_ (1),
+           cpuStart_ (0)
+      {
+         if (on_) {
+            start_ = std::chrono::steady_clock::now();
+            cpuStart_ = DgRunProfile::threadCpuNanos();
+         }
+      }
+
+     ~DgProfileScope (void)
+      {
+         if (!on_) return;
+
+         const long long int cpuNanos =
+                           DgRunProfile::threadCpuNanos() - cpuStart_;
+         DgRunProfile::record(phase_,
+               std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - start_).count(),
+               cpuNanos, count_);
+      }
+
+      // for scopes that cover a batch of operations
+      void setCount (long long int count) { count_ = count; }
+
+   private:
+
+      DgRunProfile::DgPhase phase_;
+      bool on_;
+      long long int count_;
+      std::chrono::steady_clock::time_point start_;
+      long long int cpuStart_;
+
+      DgProfileScope (const DgProfileScope&);
+      DgProfileScope& operator= (const DgProfileScope&);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
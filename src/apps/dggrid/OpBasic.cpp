@@ -39,7 +39,8 @@ using namespace dgg::addtype;
 OpBasic::OpBasic (const std::string& inFileName)
       : DgApOperationPList (inFileName),
         mainOp (*this, true), dggOp (*this, true), inOp (*this, true),
-        outOp (*this, true), primarySubOp (nullptr)
+        outOp (*this, true), primarySubOp (nullptr),
+        startTime (std::chrono::steady_clock::now()), startupSecs (0.0)
 {
 }
 
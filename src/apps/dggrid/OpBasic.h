@@ -26,6 +26,8 @@
 #ifndef OPBASIC_H
 #define OPBASIC_H
 
+#include <chrono>
+
 #include <dglib/DgUtil.h>
 
 #include <dgaplib/DgApOperationPList.h>
@@ -55,6 +57,15 @@ struct OpBasic : public DgApOperationPList {
    SubOpIn inOp;
    SubOpOut outOp;
    SubOpBasicMulti* primarySubOp;
+
+   // run timing; startup covers everything before the primary operation
+   // begins, including creating the first grid system and opening files
+   std::chrono::steady_clock::time_point startTime;
+   double startupSecs;
+
+   double secondsSinceStart (void) const
+      { return std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - startTime).count(); }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
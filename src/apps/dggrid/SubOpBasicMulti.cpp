@@ -28,6 +28,7 @@
 #include <dglib/DgBoundedIDGG.h>
 #include <dglib/DgDataField.h>
 #include <dglib/DgDataList.h>
+#include <dglib/DgUtil.h>
 
 #include "SubOpBasicMulti.h"
 #include "OpBasic.h"
@@ -38,67 +39,127 @@ SubOpBasicMulti::SubOpBasicMulti (OpBasic& _op, bool _activate)
 { }
 
 ////////////////////////////////////////////////////////////////////////////////
-DgLocationData* SubOpBasicMulti::inStrToPointLoc(const std::string& inStr) const {
-    // Setup for strtok
-    char delimStr[2];
-    delimStr[0] = op.inOp.inputDelimiter;
-    delimStr[1] = '\0';
+// parse the delimited field at p as a number, leaving p at the delimiter
+// or end following it; returns false if the fast parse doesn't apply
+static bool
+parseNumField (const char*& p, const char* end, char delimiter,
+               long double& val)
+{
+   while (p < end && *p == delimiter) p++;
+   while (p < end && isspace(*p) && *p != delimiter) p++;
 
-    // Allocate a modifiable buffer for strtok
-    char* buff = new char[inStr.length() + 1];
-    strcpy(buff, inStr.c_str());
+   const char* numEnd = dgg::util::fromChars(p, end, val);
+   if (numEnd == p || (numEnd < end && *numEnd != delimiter))
+      return false;
+
+   p = numEnd;
+   return true;
+
+} // static bool parseNumField
+
+////////////////////////////////////////////////////////////////////////////////
+DgLocationData*
+SubOpBasicMulti::inStrToPointAdd (const char* begin, const char* end,
+                                  const char*& dataBegin) const {
 
     DgLocationData* loc = nullptr;
     const char* remainder = nullptr;
 
-    if (op.inOp.inSeqNum) {
-        // Parse sequence number
-        char* snStr = strtok(buff, delimStr);
-        if (!snStr) {
-            ::report("inStrToPointLoc(): missing sequence number", DgBase::Fatal);
+    // GEO points are parsed in place
+    const DgGeoSphDegRF& deg = op.dggOp.deg();
+    if (!op.inOp.inSeqNum && op.inOp.pInRF == &deg) {
+        const char* p = begin;
+        long double lon, lat;
+        if (parseNumField(p, end, op.inOp.inputDelimiter, lon) &&
+            parseNumField(p, end, op.inOp.inputDelimiter, lat)) {
+            loc = new DgLocationData(deg);
+            deg.forceAddress(loc, DgDVec2D(lon, lat));
+
+            // any data starts after the delimiter following the latitude
+            if (p + 1 < end)
+               remainder = p + 1;
         }
+    }
 
-        unsigned long int sNum;
-        if (sscanf(snStr, "%lu", &sNum) != 1) {
-            ::report("inStrToPointLoc(): invalid SEQNUM " + std::string(snStr), DgBase::Fatal);
+    if (!loc) {
+        // Setup for tokenizing
+        char delimStr[2];
+        delimStr[0] = op.inOp.inputDelimiter;
+        delimStr[1] = '\0';
+
+        // Allocate a modifiable null-terminated copy for tokenizing
+        const size_t len = end - begin;
+        char* buff = new char[len + 1];
+        memcpy(buff, begin, len);
+        buff[len] = '\0';
+
+        const char* buffRem = nullptr;
+        if (op.inOp.inSeqNum) {
+            // Parse sequence number
+            char* tokPos = nullptr;
+            char* snStr = dgg::util::nextToken(buff, delimStr, &tokPos);
+            if (!snStr) {
+                ::report("inStrToPointLoc(): missing sequence number", DgBase::Fatal);
+            }
+
+            unsigned long int sNum;
+            if (sscanf(snStr, "%lu", &sNum) != 1) {
+                ::report("inStrToPointLoc(): invalid SEQNUM " + std::string(snStr), DgBase::Fatal);
+            }
+
+            // Retrieve location from sequence number
+            DgLocation* tmpLoc = static_cast<const DgIDGGBase&>(*op.inOp.pInRF).bndRF().locFromSeqNum(sNum);
+            loc = new DgLocationData(*tmpLoc);
+            delete tmpLoc;
+
+            if (len > strlen(buff))
+               buffRem = buff + strlen(snStr) + 1;
+        } else {
+            // Parse location directly from the copy
+            loc = new DgLocationData(*op.inOp.pInRF);
+            buffRem = loc->fromString(buff, op.inOp.inputDelimiter);
         }
 
-        // Retrieve location from sequence number
-        DgLocation* tmpLoc = static_cast<const DgIDGGBase&>(*op.inOp.pInRF).bndRF().locFromSeqNum(sNum);
-        loc = new DgLocationData(*tmpLoc);
-        delete tmpLoc;
-
-        if (inStr.length() > strlen(buff))
-           remainder = buff + strlen(snStr) + 1;
-    } else {
-        // Parse location directly from std::string
-        loc = new DgLocationData(*op.inOp.pInRF);
-        remainder = loc->fromString(buff, op.inOp.inputDelimiter);
+        // the copy has the same offsets as the input line
+        if (buffRem)
+            remainder = begin + (buffRem - buff);
+
+        delete[] buff;
     }
 
     // Skip leading whitespace in the remainder
-    while (remainder && isspace(*remainder)) {
-        remainder++;
+    dataBegin = (remainder) ? remainder : end;
+    while (dataBegin < end && isspace(*dataBegin)) {
+        dataBegin++;
     }
 
+    return loc;
+
+} // DgLocationData* SubOpBasicMulti::inStrToPointAdd
+
+////////////////////////////////////////////////////////////////////////////////
+DgLocationData*
+SubOpBasicMulti::inStrToPointLoc (const char* begin, const char* end) const {
+
+    const char* dataBegin = nullptr;
+    DgLocationData* loc = inStrToPointAdd(begin, end, dataBegin);
+
     // Parse remainder into a single data field
     DgDataList* data = nullptr;
-    if (remainder && strlen(remainder) > 0) {
+    if (dataBegin < end) {
         data = new DgDataList();
-        std::string remStr(remainder);
 
         // Create and add data field
-        DgDataFieldString* field = new DgDataFieldString("data", remStr);
+        DgDataFieldString* field =
+                 new DgDataFieldString("data", std::string(dataBegin, end));
         data->list().push_back(field);
     }
 
     // Assign the parsed data list to the location
     loc->setDataList(data);
 
-    // Clean up dynamically allocated memory
-    delete[] buff;
-
     return loc;
+
 } // DgLocationData* SubOpBasicMulti::inStrToPointLoc
 
 /*
@@ -188,6 +249,8 @@ SubOpBasicMulti::execute (bool force) {
 
    int result = 0;
 
+   op.startupSecs = op.secondsSinceStart();
+
    // process grids until lastGrid
    while (true) {
 
@@ -46,7 +46,16 @@ struct SubOpBasicMulti : public SubOpBasic {
    // default loops over the data fields in the list
    virtual std::string dataToOutStr (DgDataList* data);
    //virtual DgCell* inStrToPointCell (const std::string& inStr) const;
-   virtual DgLocationData* inStrToPointLoc (const std::string& inStr) const;
+   virtual DgLocationData* inStrToPointLoc (const char* begin,
+                                            const char* end) const;
+   DgLocationData* inStrToPointLoc (const std::string& inStr) const
+      { return inStrToPointLoc(inStr.data(), inStr.data() + inStr.size()); }
+
+   // parse the address at the start of the input line [begin, end) into a
+   // new location; sets dataBegin to the start of any data following the
+   // address (after leading whitespace), or to end if there is none
+   DgLocationData* inStrToPointAdd (const char* begin, const char* end,
+                                    const char*& dataBegin) const;
 
 };
 
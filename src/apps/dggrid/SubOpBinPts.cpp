@@ -22,7 +22,11 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <climits>
+#include <fstream>
 #include <iostream>
+#include <vector>
 
 #include <dglib/DgBoundedIDGG.h>
 #include <dglib/DgCell.h>
@@ -33,7 +37,9 @@
 #include <dglib/DgOutputStream.h>
 #include <dglib/DgDataField.h>
 #include <dglib/DgInLocTextFile.h>
+#include <dglib/DgUtil.h>
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 #include "SubOpBinPts.h"
 
@@ -48,6 +54,131 @@ struct Val {
    bool* presVec;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// values for the occupied cells of a grid, keyed by a non-zero cell key such
+// as the seqnum; an open addressing hash table with linear probing, so memory
+// use is proportional to the number of occupied cells rather than the size of
+// the grid
+
+class SparseVals {
+
+   public:
+
+      SparseVals (void) : size_ (0) { rehash(1UL << 16); }
+
+      unsigned long int size (void) const { return size_; }
+
+      // returns the value for cell key; isNew is set to true if the value
+      // was added and needs to be initialized
+      Val& insert (unsigned long long int key, bool& isNew);
+
+      // returns the value for cell key, or nullptr if it has none
+      Val* find (unsigned long long int key);
+
+      // the occupied slots in key order
+      std::vector<unsigned long int> sortedSlots (void) const;
+
+      unsigned long long int key (unsigned long int slot) const
+                              { return keys_[slot]; }
+      Val& val (unsigned long int slot) { return vals_[slot]; }
+
+   private:
+
+      std::vector<unsigned long long int> keys_; // 0 marks an empty slot
+      std::vector<Val> vals_;
+      unsigned long int size_;
+      unsigned long int mask_;
+
+      unsigned long int hash (unsigned long long int key) const
+      {
+         unsigned long long int h = key;
+         h ^= h >> 33;
+         h *= 0xff51afd7ed558ccdULL;
+         h ^= h >> 33;
+         return (unsigned long int) h & mask_;
+      }
+
+      void rehash (unsigned long int capacity);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SparseVals::rehash (unsigned long int capacity)
+{
+   std::vector<unsigned long long int> oldKeys(capacity, 0);
+   std::vector<Val> oldVals(capacity);
+   oldKeys.swap(keys_);
+   oldVals.swap(vals_);
+   mask_ = capacity - 1;
+
+   for (unsigned long int i = 0; i < oldKeys.size(); i++) {
+      if (!oldKeys[i]) continue;
+
+      unsigned long int slot = hash(oldKeys[i]);
+      while (keys_[slot])
+         slot = (slot + 1) & mask_;
+
+      keys_[slot] = oldKeys[i];
+      vals_[slot] = oldVals[i];
+   }
+
+} // void SparseVals::rehash
+
+////////////////////////////////////////////////////////////////////////////////
+Val&
+SparseVals::insert (unsigned long long int key, bool& isNew)
+{
+   // keep the load factor at or below 1/2
+   if (2 * (size_ + 1) > keys_.size())
+      rehash(2 * keys_.size());
+
+   unsigned long int slot = hash(key);
+   while (keys_[slot] && keys_[slot] != key)
+      slot = (slot + 1) & mask_;
+
+   isNew = (keys_[slot] == 0);
+   if (isNew) {
+      keys_[slot] = key;
+      size_++;
+   }
+
+   return vals_[slot];
+
+} // Val& SparseVals::insert
+
+////////////////////////////////////////////////////////////////////////////////
+Val*
+SparseVals::find (unsigned long long int key)
+{
+   unsigned long int slot = hash(key);
+   while (keys_[slot]) {
+      if (keys_[slot] == key)
+         return &vals_[slot];
+
+      slot = (slot + 1) & mask_;
+   }
+
+   return nullptr;
+
+} // Val* SparseVals::find
+
+////////////////////////////////////////////////////////////////////////////////
+std::vector<unsigned long int>
+SparseVals::sortedSlots (void) const
+{
+   std::vector<unsigned long int> slots;
+   slots.reserve(size_);
+   for (unsigned long int i = 0; i < keys_.size(); i++)
+      if (keys_[i]) slots.push_back(i);
+
+   std::sort(slots.begin(), slots.end(),
+             [this] (unsigned long int a, unsigned long int b)
+                          { return keys_[a] < keys_[b]; });
+
+   return slots;
+
+} // std::vector<unsigned long int> SparseVals::sortedSlots
+
 ////////////////////////////////////////////////////////////////////////////////
 SubOpBinPts::SubOpBinPts (OpBasic& _op, bool _activate)
    : SubOpBasicMulti (_op, _activate)
@@ -149,6 +280,7 @@ SubOpBinPts::outputCell(const DgLocation& loc, const Val& val) const
       }
 
       op.outOp.outputCellAdd2D(loc, nullptr, data);
+      delete data;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -271,31 +403,35 @@ SubOpBinPts::cleanupOp (void) {
 
 ////////////////////////////////////////////////////////////////////////////////
 DgLocationData*
-SubOpBinPts::inStrToPointLoc (const std::string& inStr) const {
+SubOpBinPts::inStrToPointLoc (const char* begin, const char* end) const {
 
-   DgLocationData* loc = SubOpBasicMulti::inStrToPointLoc(inStr);
+   if (!useValInput)
+      return SubOpBasicMulti::inStrToPointLoc(begin, end);
 
    // handle an input value
-   if (useValInput) {
+   // the first data field is the value field; other fields are ignored
+   const char* dataBegin = nullptr;
+   DgLocationData* loc = inStrToPointAdd(begin, end, dataBegin);
+   if (dataBegin >= end) {
+      ::report("inStrToPointLoc(): missing value field in file", DgBase::Fatal);
+   }
 
-      // all fields in the DataList are std::strings; replace with appropriate types
-      // first field is the value field, stored as a std::string in text input
-      // other fields are ignored
-      const DgDataFieldString* valField =
-           dynamic_cast<const DgDataFieldString*>(loc->dataList()->list()[0]);
-      const char* valStr = valField->value();
-      double val;
-      if (!sscanf(valStr, "%lf", &val)) {
+   double val;
+   if (dgg::util::fromChars(dataBegin, end, val) == dataBegin) {
+      // not a plain decimal; fall back on the C library
+      const std::string valStr(dataBegin, end);
+      if (sscanf(valStr.c_str(), "%lf", &val) != 1) {
          ::report("inStrToPointLoc(): invalid value field in file", DgBase::Fatal);
       }
-
-      loc->dataList()->clearList();
-      loc->dataList()->addField(new DgDataFieldDouble(inValFieldName, val));
    }
 
+   DgDataList* data = new DgDataList();
+   data->addField(new DgDataFieldDouble(inValFieldName, val));
+   loc->setDataList(data);
+
    return loc;
 
-} // DgLocationData* inStrToPointLoc(const std::string& inStr) const
+} // DgLocationData* inStrToPointLoc(const char* begin, const char* end) const
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -319,12 +455,40 @@ SubOpBinPts::getVal (DgLocationData& loc) const {
 
 } // double SubOpBinPts::getVal
 
+////////////////////////////////////////////////////////////////////////////////
+unsigned long long int
+SubOpBinPts::maxInputPoints (void) const {
+
+   // every input point takes at least 4 bytes (e.g., "0 0\n")
+   unsigned long long int nBytes = 0;
+   for (const auto& fileName: op.inOp.inputFiles) {
+      std::ifstream f(fileName.c_str(), std::ios::binary | std::ios::ate);
+      if (!f.is_open()) return ULLONG_MAX;
+
+      std::streamoff len = f.tellg();
+      if (len < 0) return ULLONG_MAX;
+
+      nBytes += (unsigned long long int) len;
+   }
+
+   return nBytes / 4;
+
+} // unsigned long long int SubOpBinPts::maxInputPoints
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 SubOpBinPts::binPtsGlobal (void) {
 
    const DgIDGGBase& dgg = op.dggOp.dgg();
 
+   // a sparse accumulator takes about 80 bytes per occupied cell versus about
+   // 32 bytes per cell for the full array; use it if the input can't occupy
+   // more than a quarter of the cells
+   if (maxInputPoints() < dgg.bndRF().size() / 4) {
+      binPtsGlobalSparse();
+      return;
+   }
+
    // create an array to store the values
    Val* vals = new Val[dgg.bndRF().size()];
    for (unsigned long int i = 0; i < dgg.bndRF().size(); i++)
@@ -336,23 +500,30 @@ SubOpBinPts::binPtsGlobal (void) {
    else
       dgcout << "binning points..." << std::endl;
 
-   while (1) {
+   {
+      // times reading, quantifying, and accumulating the points
+      DgProfileScope prof(DgRunProfile::BinPoints);
+      long long int nPts = 0;
+      while (1) {
 
-      DgLocationData* loc = op.inOp.getNextLoc();
-      if (!loc) break; // reached EOF on last input file
+         DgLocationData* loc = op.inOp.getNextLoc();
+         if (!loc) break; // reached EOF on last input file
+         nPts++;
 
-      dgg.convert(loc);
-      long int sNum = dgg.bndRF().seqNum(*loc);
-      long int ndx = sNum - 1;
-      vals[ndx].nVals++;
+         long int sNum = dgg.bndRF().seqNumAddress(op.inOp.quantifyLoc(*loc));
+         long int ndx = sNum - 1;
+         vals[ndx].nVals++;
 
-      if (useValInput)
-         vals[ndx].total += getVal(*loc);
+         if (useValInput)
+            vals[ndx].total += getVal(*loc);
 
-      delete loc;
+         delete loc;
 
-      if (outputPresVec)
-         vals[ndx].presVec[op.inOp.fileNum] = true;
+         if (outputPresVec)
+            vals[ndx].presVec[op.inOp.fileNum] = true;
+      }
+
+      prof.setCount(nPts);
    }
 
    ///// calculate the averages /////
@@ -383,19 +554,90 @@ SubOpBinPts::binPtsGlobal (void) {
 } // void binPtsGlobal
 
 ////////////////////////////////////////////////////////////////////////////////
-class QuadVals {
+void
+SubOpBinPts::binPtsGlobalSparse (void) {
 
-   public:
+   const DgIDGGBase& dgg = op.dggOp.dgg();
 
-      bool isUsed;
-      DgIVec2D offset;     // offset of min (i, j)
-      DgIVec2D upperRight; // (maxi, maxj) relative to offset
-      int numI;
-      int numJ;
+   SparseVals vals;
 
-      Val** vals;
+   // now process the points in each input file
+   if (useValInput)
+      dgcout << "binning point values..." << std::endl;
+   else
+      dgcout << "binning points..." << std::endl;
 
-};
+   {
+      // times reading, quantifying, and accumulating the points
+      DgProfileScope prof(DgRunProfile::BinPoints);
+      long long int nPts = 0;
+      while (1) {
+
+         DgLocationData* loc = op.inOp.getNextLoc();
+         if (!loc) break; // reached EOF on last input file
+         nPts++;
+
+         unsigned long int sNum = dgg.bndRF().seqNumAddress(op.inOp.quantifyLoc(*loc));
+         bool isNew;
+         Val& val = vals.insert(sNum, isNew);
+         if (isNew)
+            initVal(val, outputPresVec);
+
+         val.nVals++;
+
+         if (useValInput)
+            val.total += getVal(*loc);
+
+         delete loc;
+
+         if (outputPresVec)
+            val.presVec[op.inOp.fileNum] = true;
+      }
+
+      prof.setCount(nPts);
+   }
+
+   const std::vector<unsigned long int> slots = vals.sortedSlots();
+
+   ///// calculate the averages /////
+
+   if (useValInput && outputMean) {
+      for (unsigned long int i = 0; i < slots.size(); i++) {
+         Val& val = vals.val(slots[i]);
+         val.mean = (val.total / val.nVals);
+      }
+   }
+
+   ///// output the cells /////
+
+   if (outputAllCells) {
+
+      // empty cells get the same values as in the full array
+      Val empty;
+      initVal(empty, outputPresVec);
+
+      unsigned long int next = 0;
+      for (unsigned long int sNum = 1; sNum <= dgg.bndRF().size(); sNum++) {
+         if (next < slots.size() && vals.key(slots[next]) == sNum)
+            outputCell(sNum, vals.val(slots[next++]));
+         else
+            outputCell(sNum, empty);
+      }
+
+      delete [] empty.presVec;
+
+   } else {
+      for (unsigned long int i = 0; i < slots.size(); i++)
+         outputCell(vals.key(slots[i]), vals.val(slots[i]));
+   }
+
+   ///// clean-up /////
+
+   if (outputPresVec)
+      for (unsigned long int i = 0; i < slots.size(); i++)
+         delete [] vals.val(slots[i]).presVec;
+
+} // void SubOpBinPts::binPtsGlobalSparse
 
 ////////////////////////////////////////////////////////////////////////////////
 void
@@ -421,58 +663,26 @@ SubOpBinPts::binPtsPartial (void)
 {
    const DgIDGGBase& dgg = op.dggOp.dgg();
 
-   // create a place to store the values by quad
-
-   QuadVals qvals[12];
+   // the values of the occupied cells are keyed by quad, i, and j, so that
+   // key order is the order in which the cells are output; the input is
+   // read only once, and so need not be seekable
+   const unsigned long long int numI = dgg.maxI() + 1;
+   const unsigned long long int numJ = dgg.maxJ() + 1;
+   auto cellKey = [numI, numJ] (const DgQ2DICoord& add) {
+      return (add.quadNum() * numI + add.coord().i()) * numJ +
+                  add.coord().j() + 1;
+   };
+
+   SparseVals vals;
+
+   // the bounding box of the occupied cells in each quad; with OUTPUT_ALL
+   // the empty cells inside a box are output with a presence vector and
+   // those outside without one
+   DgIVec2D lowerLeft[12];
+   DgIVec2D upperRight[12];
    for (int q = 0; q < 12; q++) {
-      qvals[q].isUsed = false;
-      qvals[q].offset = DgIVec2D(dgg.maxI() + 1, dgg.maxJ() + 1);
-      qvals[q].upperRight = DgIVec2D(-1, -1);
-      qvals[q].numI = 0;
-      qvals[q].numJ = 0;
-      qvals[q].vals = 0;
-   }
-
-   // now make a first pass through the input files and determine what
-   // cells are represented
-   dgcout << "determing quad bounds..." << std::endl;
-   while (1) {
-
-      DgLocationData* loc = op.inOp.getNextLoc();
-      if (!loc) break; // reached EOF on last input file
-
-      dgg.convert(loc);
-
-      int q = dgg.getAddress(*loc)->quadNum();
-      const DgIVec2D& coord = dgg.getAddress(*loc)->coord();
-      QuadVals& qv = qvals[q];
-
-      qv.isUsed = true;
-      if (coord.i() < qv.offset.i()) qv.offset.setI(coord.i());
-      if (coord.i() > qv.upperRight.i()) qv.upperRight.setI(coord.i());
-      if (coord.j() < qv.offset.j()) qv.offset.setJ(coord.j());
-      if (coord.j() > qv.upperRight.j()) qv.upperRight.setJ(coord.j());
-
-      delete loc;
-   }
-
-   // now initialize the vals storage in the quads which are used
-
-   for (int q = 0; q < 12; q++) {
-
-      QuadVals& qv = qvals[q];
-      if (!qv.isUsed) continue;
-
-      qv.upperRight = qv.upperRight - qv.offset; // make relative
-
-      qv.numI = (int) qv.upperRight.i() + 1;
-      qv.numJ = (int) qv.upperRight.j() + 1;
-      qv.vals = new Val*[qv.numI];
-      for (int i = 0; i < qv.numI; i++) {
-         qv.vals[i] = new Val[qv.numJ];
-         for (int j = 0; j < qv.numJ; j++)
-            initVal(qv.vals[i][j], outputPresVec);
-      }
+      lowerLeft[q] = DgIVec2D(dgg.maxI() + 1, dgg.maxJ() + 1);
+      upperRight[q] = DgIVec2D(-1, -1);
    }
 
    // now process the points in each input file
@@ -481,112 +691,111 @@ SubOpBinPts::binPtsPartial (void)
    else
       dgcout << "binning points..." << std::endl;
 
-   op.inOp.resetInFile(); // start again with first input file
-   while (1) {
+   {
+      // times reading, quantifying, and accumulating the points
+      DgProfileScope prof(DgRunProfile::BinPoints);
+      long long int nPts = 0;
+      while (1) {
 
-      DgLocationData* loc = op.inOp.getNextLoc();
-      if (!loc) break; // reached EOF on last input file
-//cout << *loc << std::endl;
+         DgLocationData* loc = op.inOp.getNextLoc();
+         if (!loc) break; // reached EOF on last input file
+         nPts++;
+   //cout << *loc << std::endl;
 
-      dgg.convert(loc);
-      int q = dgg.getAddress(*loc)->quadNum();
-      QuadVals& qv = qvals[q];
-      DgIVec2D coord = dgg.getAddress(*loc)->coord() - qv.offset;
+         const DgQ2DICoord add = op.inOp.quantifyLoc(*loc);
+         const int q = add.quadNum();
+         const DgIVec2D& coord = add.coord();
+         if (coord.i() < lowerLeft[q].i()) lowerLeft[q].setI(coord.i());
+         if (coord.i() > upperRight[q].i()) upperRight[q].setI(coord.i());
+         if (coord.j() < lowerLeft[q].j()) lowerLeft[q].setJ(coord.j());
+         if (coord.j() > upperRight[q].j()) upperRight[q].setJ(coord.j());
 
-      qv.vals[coord.i()][coord.j()].nVals++;
+         bool isNew;
+         Val& val = vals.insert(cellKey(add), isNew);
+         if (isNew)
+            initVal(val, outputPresVec);
 
-      if (useValInput)
-         qv.vals[coord.i()][coord.j()].total += getVal(*loc);
+         val.nVals++;
 
-      delete loc;
+         if (useValInput)
+            val.total += getVal(*loc);
+
+         delete loc;
 
-      if (outputPresVec)
-         qv.vals[coord.i()][coord.j()].presVec[op.inOp.fileNum] = true;
+         if (outputPresVec)
+            val.presVec[op.inOp.fileNum] = true;
+      }
+
+      prof.setCount(nPts);
    }
 
+   const std::vector<unsigned long int> slots = vals.sortedSlots();
+
    ///// calculate the averages /////
 
    if (useValInput && outputMean) {
-      for (int q = 0; q < 12; q++) {
-
-         QuadVals& qv = qvals[q];
-         if (!qv.isUsed) continue;
-
-         for (int i = 0; i < qv.numI; i++) {
-            for (int j = 0; j < qv.numJ; j++) {
-               if (qv.vals[i][j].nVals > 0)
-                  qv.vals[i][j].mean = (qv.vals[i][j].total / qv.vals[i][j].nVals);
-            }
-         }
+      for (unsigned long int i = 0; i < slots.size(); i++) {
+         Val& val = vals.val(slots[i]);
+         val.mean = (val.total / val.nVals);
       }
    }
 
    ///// output the values /////
 
    if (outputAllCells) {
+
+      // empty cells inside the bounding box of their quad get a presence
+      // vector, and those outside it don't
+      Val empty;
+      initVal(empty, outputPresVec);
+      Val outside;
+      initVal(outside, false); // don't allocate presVec
+
       for (unsigned long int i = 0; i < dgg.bndRF().size(); i++) {
          unsigned long int sNum = i + 1;
          DgLocation* loc = dgg.bndRF().locFromSeqNum(sNum);
 
          // check to see if there is a value for this cell
-         int q = dgg.getAddress(*loc)->quadNum();
-         QuadVals& qv = qvals[q];
-         Val outVal;
-         initVal(outVal, false); // don't allocate presVec
-         if (qv.isUsed) {
-            DgIVec2D coord = dgg.getAddress(*loc)->coord() - qv.offset;
-            if (coord.i() >= 0 && coord.j() >= 0 &&
-                   coord.i() <= qv.upperRight.i() &&
-                   coord.j() <= qv.upperRight.j()) {
-                outVal = qv.vals[coord.i()][coord.j()]; // shallow copy
-            }
+         const DgQ2DICoord& add = *dgg.getAddress(*loc);
+         const Val* val = vals.find(cellKey(add));
+         if (!val) {
+            const int q = add.quadNum();
+            const DgIVec2D& coord = add.coord();
+            const bool inBox = coord.i() >= lowerLeft[q].i() &&
+                               coord.j() >= lowerLeft[q].j() &&
+                               coord.i() <= upperRight[q].i() &&
+                               coord.j() <= upperRight[q].j();
+            val = (inBox) ? &empty : &outside;
          }
 
          // output the value
-         outputCell(*loc, outVal);
+         outputCell(*loc, *val);
 
          delete loc;
       }
-   } else {
-      for (int q = 0; q < 12; q++) {
-         QuadVals& qv = qvals[q];
-         if (!qv.isUsed) continue;
 
-         for (int i = 0; i < qv.numI; i++) {
-            for (int j = 0; j < qv.numJ; j++) {
-               Val outVal;
-               initVal(outVal, false); // don't allocate presVec
-               outVal = qv.vals[i][j]; // shallow copy
-               if (outVal.nVals == 0) continue;
+      delete [] empty.presVec;
 
-               DgIVec2D coord(qv.offset.i() + i, qv.offset.j() + j);
+   } else {
+      for (unsigned long int i = 0; i < slots.size(); i++) {
+         unsigned long long int key = vals.key(slots[i]) - 1;
+         long long int j = key % numJ;
+         key /= numJ;
+         long long int iCoord = key % numI;
+         int q = (int) (key / numI);
 
-               DgLocation* loc = dgg.makeLocation(DgQ2DICoord(q, coord));
-               outputCell(*loc, outVal);
+         DgLocation* loc = dgg.makeLocation(DgQ2DICoord(q, DgIVec2D(iCoord, j)));
+         outputCell(*loc, vals.val(slots[i]));
 
-               delete loc;
-            }
-         }
+         delete loc;
       }
    }
 
    ///// clean-up /////
 
-   for (int q = 0; q < 12; q++) {
-      QuadVals& qv = qvals[q];
-      if (!qv.isUsed) continue;
-
-      for (int i = 0; i < qv.numI; i++) {
-
-         if (outputPresVec)
-            for (int j = 0; j < qv.numJ; j++)
-               delete [] qv.vals[i][j].presVec;
-
-         delete [] qv.vals[i];
-      }
-
-      delete [] qv.vals;
-   }
+   if (outputPresVec)
+      for (unsigned long int i = 0; i < slots.size(); i++)
+         delete [] vals.val(slots[i]).presVec;
 
 } // void SubOpBinPts::binPtsPartial
 
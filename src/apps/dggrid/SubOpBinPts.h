@@ -71,13 +71,20 @@ struct SubOpBinPts : public SubOpBasicMulti {
    protected:
 
       // helper methods
-      virtual DgLocationData* inStrToPointLoc (const std::string& inStr) const;
+      using SubOpBasicMulti::inStrToPointLoc;
+      virtual DgLocationData* inStrToPointLoc (const char* begin,
+                                               const char* end) const;
       virtual double getVal (DgLocationData& loc) const;
       void initVal (Val& val, bool allocPresVec) const;
       int presVecToString (const bool* presVec, int allClasses,
                   std::string& vecStr) const;
 
+      // an upper bound on the number of input points based on the input
+      // file sizes; ULLONG_MAX if the sizes can't be determined
+      unsigned long long int maxInputPoints (void) const;
+
       void binPtsGlobal (void);
+      void binPtsGlobalSparse (void);
       void binPtsPartial (void);
       void outputCell(unsigned long int sNum, const Val& val) const;
       void outputCell(const DgLocation& loc, const Val& val) const;
@@ -22,6 +22,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+
 #include <dglib/DgConstants.h>
 #include <dglib/DgConverterBase.h>
 #include <dglib/DgAddressType.h>
@@ -37,6 +39,7 @@
 #include <dglib/DgZ3System.h>
 #include <dglib/DgHierNdxSystemRFSBase.h>
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 #include "SubOpDGG.h"
 
@@ -47,10 +50,12 @@ const int SubOpDGG::MAX_DGG_RES = 35;
 
 ////////////////////////////////////////////////////////////////////////////////
 SubOpDGG::SubOpDGG (OpBasic& op, bool _activate)
-   : SubOpBasic (op, _activate),
+   : SubOpBasic (op, _activate), dggsSecs (0.0),
      dggsType (""), gridTopo (dgg::topo::InvalidTopo),
      gridMetric (dgg::topo::InvalidMetric), aperture (4),
-     projType ("ISEA"), res (5), actualRes (5),
+     projType ("ISEA"), precisionMode (DgSphIcosa::Exact),
+     inverseMethod (DgSphIcosa::Iterative),
+     res (5), actualRes (5),
      placeRandom (false), orientCenter (false), orientRand (0),
      numGrids (1), curGrid (0), lastGrid (false), sampleCount(0), nSamplePts(0),
      azimuthDegs (0.0), datum (""), apertureType (""),
@@ -180,6 +185,13 @@ SubOpDGG::initializeOp (void)
    // dggs_proj <ISEA | FULLER | GNOMONIC>
    pList().insertParam("dggs_proj", "ISEA", {"ISEA", "FULLER" /*, "GNOMONIC"*/ });
 
+   // precision_mode <EXACT | FAST>
+   pList().insertParam("precision_mode", "EXACT", {"EXACT", "FAST"});
+
+   // isea_inverse_method <ITERATIVE | INTERPOLATED>
+   pList().insertParam("isea_inverse_method", "ITERATIVE",
+                       {"ITERATIVE", "INTERPOLATED"});
+
    // dggs_aperture_type <PURE | MIXED43 | SEQUENCE>
    pList().insertParam("dggs_aperture_type", "PURE", {"PURE", "MIXED43", "SEQUENCE"});
 
@@ -392,6 +404,18 @@ SubOpDGG::setupOp (void)
 
    getParamValue(pList(), "dggs_num_placements", numGrids, false);
    getParamValue(pList(), "dggs_proj", projType, false);
+
+   // the fast kernels are only implemented for the ISEA projection
+   std::string precStr;
+   getParamValue(pList(), "precision_mode", precStr, false);
+   precisionMode = (precStr == "FAST" && projType == "ISEA") ? DgSphIcosa::Fast
+                                                            : DgSphIcosa::Exact;
+
+   std::string invStr;
+   getParamValue(pList(), "isea_inverse_method", invStr, false);
+   inverseMethod = (invStr == "INTERPOLATED" && projType == "ISEA")
+                      ? DgSphIcosa::Interpolated : DgSphIcosa::Iterative;
+
    getParamValue(pList(), "dggs_vert0_azimuth", azimuthDegs, false);
 
    long double lon0, lat0;
@@ -511,6 +535,9 @@ SubOpDGG::executeOp (void) {
 
    orientGrid();
 
+   auto start = std::chrono::steady_clock::now();
+   DgProfileScope prof(DgRunProfile::GridConstruction);
+
    if (curGrid == 1) {
       _pGeoRF = DgGeoSphRF::makeRF(net0(), datum, earthRadius);
    }
@@ -519,6 +546,8 @@ SubOpDGG::executeOp (void) {
              azimuthDegs, aperture, actualRes+2, gridTopo,
              gridMetric, "IDGGS", projType, isApSeq, apSeq,
              isMixed43, numAp4, isSuperfund, hierNdxSysType);
+   dggs().sphIcosa().setPrecisionMode(precisionMode);
+   dggs().sphIcosa().setInverseMethod(inverseMethod);
 
    _pDGG = &dggs().idggBase(actualRes);
 
@@ -534,6 +563,9 @@ SubOpDGG::executeOp (void) {
    if (_pPrtDgg)
        _pPrtDeg = DgGeoSphDegRF::makeRF(_pPrtDgg->geoRF(), _pPrtDgg->geoRF().name() + "Deg");
 
+   dggsSecs += std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count();
+
    return 0;
 
 } // SubOpDGG::executeOp
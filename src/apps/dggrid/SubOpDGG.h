@@ -88,12 +88,16 @@ struct SubOpDGG : public SubOpBasic {
    const DgIDGGBase*    _pPrtDgg;   // indexing parent res dgg
    const DgGeoSphDegRF* _pPrtDeg;
 
+   double dggsSecs;   // time spent creating the grid systems
+
    // the parameters
    std::string dggsType;              // preset DGGS type
    dgg::topo::DgGridTopology gridTopo;      // Diamond/Hexagon/Triangle
    dgg::topo::DgGridMetric   gridMetric;    // D4/D8
    int aperture;      // aperture
    std::string projType;   // projection type
+   DgSphIcosa::DgPrecisionMode precisionMode; // projection kernel precision
+   DgSphIcosa::DgInverseMethod inverseMethod; // inverse ISEA azimuth method
    int res;           // resolution (may be adjusted)
    int actualRes;     // original, actual resolution
    bool placeRandom;  // random grid placement?
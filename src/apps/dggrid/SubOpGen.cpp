@@ -83,7 +83,8 @@ SubOpGen::SubOpGen (OpBasic& op, bool _activate)
      clipAIGen (false), clipGDAL(false), clipShape(false), clipCellRes (0),
      addressFiles(false),
      nClipCellDensify (1), nudge (0.001), doPointInPoly (true),
-     doPolyIntersect (false)
+     doPolyIntersect (false), clipHierarchical (false),
+     nCellsIntersected (0), nIntersectedAccepted (0)
 {
    // turn-on/off the available sub operations
    op.mainOp.active = true;
@@ -141,6 +142,9 @@ SubOpGen::initializeOp (void)
    // clipper_scale_factor <unsigned long int>
    pList().insertParam(new DgULIntParam("clipper_scale_factor", 1000000L, 1, ULONG_MAX, true));
 
+   // clip_method <SCAN | HIERARCHICAL>
+   pList().insertParam("clip_method", "SCAN", {"SCAN", "HIERARCHICAL"});
+
    return 0;
 
 } // int SubOpGen::initializeOp
@@ -244,6 +248,13 @@ SubOpGen::setupOp (void)
    getParamValue(pList(), "clipper_scale_factor", clipperFactor, false);
    invClipperFactor = 1.0L / clipperFactor;
 
+   getParamValue(pList(), "clip_method", dummy, false);
+   clipHierarchical = (dgg::util::toUpper(dummy) == "HIERARCHICAL");
+   if (clipHierarchical && !wholeEarth && !addressGen &&
+          op.mainOp.numThreads > 1)
+      ::report("num_threads is ignored with clip_method HIERARCHICAL; "
+               "clipping with a single thread", DgBase::Warning);
+
    return 0;
 
 } // SubOpGen::setupOp
@@ -34,7 +34,10 @@
 #include <ogrsf_frmts.h>
 #endif
 #include "clipper.hpp"
+#include "DgCellTemplate.h"
+#include "DgClipRaster.h"
 #include <dglib/DgIVec2D.h>
+#include <dglib/DgDVec2D.h>
 #include <dglib/DgProjGnomonicRF.h>
 #include <dglib/DgInShapefileAtt.h>
 #include "SubOpBasicMulti.h"
@@ -70,6 +73,9 @@ struct DgClippingPoly {
       // the exterior polygon(s) for clipper intersection
       ClipperLib::Paths exterior;
 
+      // classifies cells against exterior without clipper
+      DgClipRaster raster;
+
 #ifdef USE_GDAL
       // the holes for gdal containment
       std::vector<DgClippingHole> holes;
@@ -93,10 +99,17 @@ class DgQuadClipRegion {
      ~DgQuadClipRegion (void) { }
 
       std::vector<DgClippingPoly>& clpPolys (void) { return clpPolys_; }
+      const std::vector<DgClippingPoly>& clpPolys (void) const
+                    { return clpPolys_; }
       std::vector < std::set<DgDBFfield> >& polyFields (void) { return polyFields_; }
+      const std::vector < std::set<DgDBFfield> >& polyFields (void) const
+                    { return polyFields_; }
 
       std::set<DgIVec2D>& points (void) { return points_; }
+      const std::set<DgIVec2D>& points (void) const { return points_; }
       std::map<DgIVec2D, std::set<DgDBFfield> >& ptFields (void) { return ptFields_; }
+      const std::map<DgIVec2D, std::set<DgDBFfield> >& ptFields (void) const
+                    { return ptFields_; }
 
       int quadNum (void) const { return quadNum_; }
       void setQuadNum (int q) { quadNum_ = q; }
@@ -195,6 +208,56 @@ class DgEvalData {
         { }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// a candidate cell for multi-threaded clipping
+struct DgClipCandidate {
+
+   DgClipCandidate (const DgIVec2D& coordIn, bool preAcceptedIn)
+      : coord (coordIn), preAccepted (preAcceptedIn),
+        tested (false), accepted (false), intersected (false) { }
+
+   DgIVec2D coord;
+   bool preAccepted;                // accepted from the overage set
+   bool tested;                     // counts as a tested cell
+   bool accepted;                   // passed the clipping test
+   bool intersected;                // required a polygon intersection
+   std::set<DgDBFfield> fields;     // intersected fields
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// DgClipBlockData class for hierarchical clipping of one quad
+class DgClipBlockData {
+
+   public:
+
+      const DgIDGGBase& dgg;
+      DgQuadClipRegion& clipRegion;
+
+      // cells that are output without being tested
+      const std::set<DgIVec2D>& overageSet;
+
+      // cell centers in clipper units are c0 + i * di + j * dj; each cell's
+      // vertices are within (rx, ry) of its center
+      DgDVec2D c0;
+      DgDVec2D di;
+      DgDVec2D dj;
+      long double rx;
+      long double ry;
+
+      // the accepted cells and the index of their fields in cellFields
+      std::vector< std::pair<DgIVec2D, int> > cells;
+      std::vector< std::set<DgDBFfield> > cellFields;
+
+      DgClipBlockData (const DgIDGGBase& dggIn, DgQuadClipRegion& clipRegionIn,
+                       const std::set<DgIVec2D>& overageSetIn)
+      : dgg (dggIn), clipRegion (clipRegionIn), overageSet (overageSetIn),
+        rx (0.0L), ry (0.0L)
+        { }
+
+      bool isOverage (const DgIVec2D& coord) const
+        { return !overageSet.empty() && overageSet.count(coord); }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 struct SubOpGen : public SubOpBasicMulti {
 
@@ -209,10 +272,24 @@ struct SubOpGen : public SubOpBasicMulti {
    // internal helper methods
    void outputStatus (bool force = false);
    void genGrid (void);
+   void genWholeEarthThreaded (unsigned long long int startCell);
    bool evalCell (DgEvalData* data, DgIVec2D& add2D);
    bool evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
                   const DgDiscRF2D& grid, DgQuadClipRegion& clipRegion,
                   const DgIVec2D& add2D);
+   bool clipCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
+                  const DgDiscRF2D& grid, const DgQuadClipRegion& clipRegion,
+                  const DgIVec2D& add2D, ClipperLib::Clipper& clipper,
+                  std::set<DgDBFfield>& fields, bool& intersected) const;
+   void evalClipBatch (const DgIDGGBase& dgg, int q,
+                  DgQuadClipRegion& clipRegion,
+                  std::vector<DgClipCandidate>& batch);
+   void genClipQuadHierarchical (const DgIDGGBase& dgg, int q,
+                  DgQuadClipRegion& clipRegion, std::set<DgIVec2D>& overageSet);
+   void refineClipBlock (DgClipBlockData& data, const DgIVec2D& lLeft,
+                  const DgIVec2D& uRight);
+   int classifyClipBlock (DgClipBlockData& data, const DgIVec2D& lLeft,
+                  const DgIVec2D& uRight, std::set<DgDBFfield>& fields) const;
    ClipperLib::Paths* intersectPolyWithQuad (const DgPolygon& v, DgQuadClipRegion& clipRegion);
    void processOneClipPoly (DgPolygon& polyIn, const DgIDGGBase& dgg,
              DgQuadClipRegion clipRegions[], DgInShapefileAtt* pAttributeFile);
@@ -245,7 +322,13 @@ struct SubOpGen : public SubOpBasicMulti {
    unsigned long int clipperFactor;   // clipper scaling factor
    long double invClipperFactor;      // 1.0L / clipper scaling factor
    bool useHoles;                     // handle holes in clipping polygons
+   bool clipHierarchical;             // clip by refining blocks of cells
    long double geoDens;               // max arc length in radians
+   DgCellTemplate cellTemplate;       // candidate cell boundaries
+
+   // cells that required a polygon intersection and how many were accepted
+   unsigned long long int nCellsIntersected;
+   unsigned long long int nIntersectedAccepted;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,14 @@
 #include <iostream>
 #include <set>
 #include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 
 #include "clipper.hpp"
 #include <dglib/DgIVec2D.h>
@@ -69,9 +77,15 @@
 */
 #include "DgHexSF.h"
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 #include "SubOpGen.h"
 
+// whole earth grids are generated in chunks of this many cells; the output
+// vertex cache is cleared at the start of each chunk so that the cell
+// boundaries output don't depend on the number of threads
+static const unsigned long long int wholeEarthChunkSize = 1000;
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 SubOpGen::outputStatus (bool force)
@@ -105,41 +119,73 @@ SubOpGen::evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
    if (op.mainOp.megaVerbose)
       dgcout << "Testing #" << op.outOp.nCellsTested << ": " << add2D << std::endl;
 
-   bool accepted = false;
+   ClipperLib::Clipper clipper;
+   bool intersected = false;
+   bool accepted = clipCell(dgg, cc1, grid, clipRegion, add2D, clipper,
+                            op.outOp.curFields, intersected);
+   if (intersected) {
+      nCellsIntersected++;
+      if (accepted) nIntersectedAccepted++;
+   }
 
-   // start by checking the points
+   // each point only needs to be found once
    std::set<DgIVec2D>::iterator it = clipRegion.points().find(add2D);
    if (it != clipRegion.points().end()) {
+      clipRegion.points().erase(it);
+      if (op.outOp.buildShapeFileAttributes)
+         clipRegion.ptFields().erase(add2D);
+   }
+
+   return accepted;
+
+} // bool SubOpGen::evalCell
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+SubOpGen::clipCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
+               const DgDiscRF2D& grid, const DgQuadClipRegion& clipRegion,
+               const DgIVec2D& add2D, ClipperLib::Clipper& clipper,
+               std::set<DgDBFfield>& fields, bool& intersected) const
+//
+// Test add2D against the points and polygons of clipRegion, adding the
+// attribute fields of any intersected points/polygons to fields. Sets
+// intersected if a clipper polygon intersection was required. Only the
+// arguments are modified, so this may be called from multiple threads as
+// long as each uses its own clipper.
+//
+{
+   DgProfileScope prof(DgRunProfile::CandidateEval);
+
+   bool accepted = false;
+
+   // start by checking the points
+   if (clipRegion.points().find(add2D) != clipRegion.points().end()) {
 
       accepted = true;
-      clipRegion.points().erase(it);
 
       if (op.outOp.buildShapeFileAttributes) {
 
          // add the fields for this point
-         std::map<DgIVec2D, std::set<DgDBFfield> >::iterator itFields =
-                           clipRegion.ptFields().find(add2D);
-         const std::set<DgDBFfield>& fields = itFields->second;
-         for (std::set<DgDBFfield>::iterator it = fields.begin();
-                it != fields.end(); it++)
-            op.outOp.curFields.insert(*it);
-
-         clipRegion.ptFields().erase(itFields);
+         const std::set<DgDBFfield>& ptFields =
+                           clipRegion.ptFields().find(add2D)->second;
+         fields.insert(ptFields.begin(), ptFields.end());
       } else // only need one intersection
          return accepted;
    }
 
-   // generate the boundary
-
-   DgLocation* loc = grid.makeLocation(add2D);
-
-   DgPolygon verts;
-   grid.setVertices(add2D, verts);
-
-   cc1.convert(loc);
-   delete loc;
+   // generate the boundary in the ccFrame
 
-   cc1.convert(verts);
+   std::vector<DgDVec2D> verts;
+   {
+      DgProfileScope profVerts(DgRunProfile::Vertices);
+      if (!cellTemplate.isValid() || !cellTemplate.setVertices(add2D, verts)) {
+         DgPolygon poly;
+         grid.setVertices(add2D, poly);
+         cc1.convert(poly);
+         for (int i = 0; i < poly.size(); i++)
+            verts.push_back(*cc1.getAddress(poly[i]));
+      }
+   }
 
    // discard cells that don't meet poly-intersect clipping criteria if
    // applicable
@@ -153,8 +199,7 @@ SubOpGen::evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
       bool okmaxx = false;
       bool okminy = false;
       bool okmaxy = false;
-      for (int i = 0; i < verts.size(); i++) {
-         const DgDVec2D& p0 = *cc1.getAddress((verts)[i]);
+      for (const auto& p0: verts) {
          if (!okminx && p0.x() > clipRegion.minx()) okminx = true;
          if (!okminy && p0.y() > clipRegion.miny()) okminy = true;
          if (!okmaxx && p0.x() < clipRegion.maxx()) okmaxx = true;
@@ -165,22 +210,46 @@ SubOpGen::evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
          accepted = false;
       } else {
          ClipperLib::Paths cellPoly(1);
-         for (int i = 0; i < verts.size(); i++)
+         for (const auto& p: verts)
            cellPoly[0] <<
-              ClipperLib::IntPoint(clipperFactor * cc1.getAddress((verts)[i])->x(),
-                                   clipperFactor * cc1.getAddress((verts)[i])->y());
+              ClipperLib::IntPoint(clipperFactor * p.x(), clipperFactor * p.y());
+
+         // the cell bounding box for the clip rasters
+         ClipperLib::IntPoint cellMin(cellPoly[0][0]);
+         ClipperLib::IntPoint cellMax(cellPoly[0][0]);
+         for (const auto& p: cellPoly[0]) {
+            if (p.X < cellMin.X) cellMin.X = p.X;
+            if (p.Y < cellMin.Y) cellMin.Y = p.Y;
+            if (p.X > cellMax.X) cellMax.X = p.X;
+            if (p.Y > cellMax.Y) cellMax.Y = p.Y;
+         }
 
          for (unsigned int i = 0; i < clipRegion.clpPolys().size(); i++) {
 
-           ClipperLib::Clipper c;
-           c.AddPaths(cellPoly, ClipperLib::ptSubject, true);
-           c.AddPaths(clipRegion.clpPolys()[i].exterior, ClipperLib::ptClip, true);
+           // only cells on the polygon boundary need a clipper intersection
+           DgClipRaster::DgTileClass cellClass =
+                  clipRegion.clpPolys()[i].raster.classify(cellMin, cellMax);
+           if (cellClass == DgClipRaster::Outside) continue;
 
-           ClipperLib::Paths solution;
-           c.Execute(ClipperLib::ctIntersection, solution, ClipperLib::pftNonZero,
-                     ClipperLib::pftNonZero);
+           bool intersects = (cellClass == DgClipRaster::Inside);
+           if (!intersects) {
+              intersected = true;
 
-           if (solution.size() != 0) {
+              clipper.Clear();
+              clipper.AddPaths(cellPoly, ClipperLib::ptSubject, true);
+              clipper.AddPaths(clipRegion.clpPolys()[i].exterior, ClipperLib::ptClip, true);
+
+              ClipperLib::Paths solution;
+              {
+                 DgProfileScope profClip(DgRunProfile::ClipperCalls);
+                 clipper.Execute(ClipperLib::ctIntersection, solution,
+                        ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+              }
+
+              intersects = (solution.size() != 0);
+           }
+
+           if (intersects) {
               accepted = true; // a hole may make this false
 #ifdef USE_GDAL
               if (useHoles) {
@@ -188,12 +257,15 @@ SubOpGen::evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
                  if (numHoles > 0) {
 
                     // assume hole on the snyder quad are most likely
-                    OGRPolygon* snyderHex = DgOutGdalFile::createPolygon(verts);
+                    DgPolygon ccHex(cc1);
+                    for (const auto& p: verts)
+                       ccHex.addressVec().push_back(new DgAddress<DgDVec2D>(p));
+                    OGRPolygon* snyderHex = DgOutGdalFile::createPolygon(ccHex);
                     // lazy instantiate the quad gnomonic version if needed
                     OGRPolygon* gnomHex = NULL;
 
                     for (int h = 0; h < numHoles; h++) {
-                       DgClippingHole clipHole = clipRegion.clpPolys()[i].holes[h];
+                       const DgClippingHole& clipHole = clipRegion.clpPolys()[i].holes[h];
 
                        // need to choose correct projection; assume snyder hole
                        const OGRPolygon* hex = snyderHex;
@@ -214,7 +286,12 @@ SubOpGen::evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
                        }
 
                        // check if the hole contains the hex
-                       if (clipHole.hole.Contains(hex)) {
+                       bool inHole = false;
+                       {
+                          DgProfileScope profHole(DgRunProfile::HoleTests);
+                          inHole = clipHole.hole.Contains(hex);
+                       }
+                       if (inHole) {
                           accepted = false;
                           break;
                        }
@@ -231,10 +308,8 @@ SubOpGen::evalCell (const DgIDGGBase& dgg, const DgContCartRF& cc1,
               failure  = false;
               if (op.outOp.buildShapeFileAttributes) {
                  // add the fields for this polygon
-                 const std::set<DgDBFfield>& fields = clipRegion.polyFields()[i];
-                 for (std::set<DgDBFfield>::iterator it = fields.begin();
-                          it != fields.end(); it++)
-                   op.outOp.curFields.insert(*it);
+                 const std::set<DgDBFfield>& polyFields = clipRegion.polyFields()[i];
+                 fields.insert(polyFields.begin(), polyFields.end());
               } else { // only need one intersection
                  goto EVALCELL_FINISH;
               }
@@ -255,7 +330,7 @@ EVALCELL_FINISH:
 
    return accepted;
 
-} // bool SubOpGen::evalCell
+} // bool SubOpGen::clipCell
 
 ////////////////////////////////////////////////////////////////////////////////
 bool
@@ -457,40 +532,47 @@ SubOpGen::executeOp (void)
       {
          unsigned long long int startCell = op.outOp.outFirstSeqNum - 1;
          //unsigned long long int startCell = op.outOp.maxCellsPerFile * (op.outOp.outFirstSeqNum - 1);
-         DgLocation* addLoc = new DgLocation(dgg.bndRF().first());
-         bool more = true;
-
-         // skip cells up to the first desired output file; this needs to be done
-         // with seqNum to address converters
-         while (op.outOp.nCellsTested < startCell)
-         {
-            //op.outOp.nCellsAccepted++;
-            op.outOp.nCellsTested++;
-            outputStatus();
+         if (op.mainOp.numThreads > 1) {
+            genWholeEarthThreaded(startCell);
+         } else {
+            DgLocation* addLoc = new DgLocation(dgg.bndRF().first());
+            bool more = true;
 
-            dgg.bndRF().incrementLocation(*addLoc);
-            if (!dgg.bndRF().validLocation(*addLoc))
+            // skip cells up to the first desired output file; this needs to be done
+            // with seqNum to address converters
+            while (op.outOp.nCellsTested < startCell)
             {
-               more = false;
-               break;
+               //op.outOp.nCellsAccepted++;
+               op.outOp.nCellsTested++;
+               outputStatus();
+
+               dgg.bndRF().incrementLocation(*addLoc);
+               if (!dgg.bndRF().validLocation(*addLoc))
+               {
+                  more = false;
+                  break;
+               }
             }
-         }
 
-         if (more)
-         {
-            while (op.outOp.nCellsTested < op.outOp.outLastSeqNum)
+            if (more)
             {
-               op.outOp.nCellsAccepted++;
-               op.outOp.nCellsTested++;
-               outputStatus();
+               while (op.outOp.nCellsTested < op.outOp.outLastSeqNum)
+               {
+                  if ((op.outOp.nCellsTested - startCell) % wholeEarthChunkSize == 0)
+                     op.outOp.vertCache.clear();
 
-               op.outOp.outputCellAdd2D(*addLoc);
+                  op.outOp.nCellsAccepted++;
+                  op.outOp.nCellsTested++;
+                  outputStatus();
 
-               dgg.bndRF().incrementLocation(*addLoc);
-               if (!dgg.bndRF().validLocation(*addLoc)) break;
+                  op.outOp.outputCellAdd2D(*addLoc);
+
+                  dgg.bndRF().incrementLocation(*addLoc);
+                  if (!dgg.bndRF().validLocation(*addLoc)) break;
+               }
             }
+            delete addLoc;
          }
-         delete addLoc;
       }
       else { // isSuperfund
          for (int q = 0; q < 12; q++) {
@@ -570,10 +652,19 @@ SubOpGen::executeOp (void)
             baseTile.setType('P');
             baseTile.depthFirstTraversal(*dggs, dgg, op.dggOp.deg(), 2, &ed);
          }
+         else if (clipHierarchical && clipRegions[q].isQuadUsed())
+         {
+            genClipQuadHierarchical(dgg, q, clipRegions[q], overageSet[q]);
+         }
          else // !isSuperfund
          {
             DgBoundedRF2D b1(grid, DgIVec2D(0, 0), (uRight - lLeft));
             DgIVec2D tCoord = lLeft; // where are we on the grid?
+
+            // the polar quads have only one cell, so don't bother threading
+            const bool threaded = op.mainOp.numThreads > 1 && q != 0 && q != 11;
+            const unsigned long int clipBatchSize = 4096;
+            std::vector<DgClipCandidate> batch;
             while (!overageSet[q].empty() || clipRegions[q].isQuadUsed())
             {
                DgIVec2D coord = tCoord;
@@ -655,6 +746,15 @@ SubOpGen::executeOp (void)
                 }
  */
 
+               // evaluate the candidates in parallel batches
+               if (threaded) {
+                  batch.push_back(DgClipCandidate(coord, accepted));
+                  if (batch.size() >= clipBatchSize)
+                     evalClipBatch(dgg, q, clipRegions[q], batch);
+
+                  continue;
+               }
+
                outputStatus();
 
                if (!accepted)
@@ -674,6 +774,9 @@ SubOpGen::executeOp (void)
                // check for special cases
                if (q == 0 || q == 11) break; // only one cell
             }
+
+            if (!batch.empty())
+               evalClipBatch(dgg, q, clipRegions[q], batch);
          } // else !dp.isSuperfund
 
          dgcout << "...quad " << q << " complete." << std::endl;
@@ -683,17 +786,547 @@ SubOpGen::executeOp (void)
 
    dgcout << "\n** grid generation complete **" << std::endl;
    outputStatus(true);
-   if (!wholeEarth && !addressGen)
+   if (!wholeEarth && !addressGen) {
       dgcout << "acceptance rate is " <<
           100.0 * (long double) op.outOp.nCellsAccepted / (long double) op.outOp.nCellsTested <<
           "%" << std::endl;
 
+      if (doPolyIntersect && op.outOp.nCellsTested) {
+         dgcout << dgg::util::addCommas(nCellsIntersected)
+              << " cells required polygon intersection ("
+              << 100.0 * (long double) nCellsIntersected / (long double) op.outOp.nCellsTested
+              << "% of tested)";
+         if (nCellsIntersected)
+            dgcout << "; their acceptance rate is "
+                 << 100.0 * (long double) nIntersectedAccepted / (long double) nCellsIntersected
+                 << "%";
+         dgcout << std::endl;
+      }
+   }
+
    dgcout << std::endl;
 
    return 0;
 
 } // int SubOpGen::executeOp
 
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpGen::genWholeEarthThreaded (unsigned long long int startCell)
+//
+// Generate the whole earth grid using op.mainOp.numThreads worker threads.
+// The seqnum range is split into fixed-size chunks which the workers claim
+// in order and fill with DgCellOutput's; this thread writes the chunks in
+// seqnum order, so the output is identical to the single-threaded version.
+//
+////////////////////////////////////////////////////////////////////////////////
+{
+   const DgIDGGBase& dgg = op.dggOp.dgg();
+   const DgBoundedIDGG& bndRF = dgg.bndRF();
+
+   // cells to generate are seqnums startCell + 1 through lastCell
+   unsigned long long int lastCell = bndRF.size();
+   if (op.outOp.outLastSeqNum < lastCell)
+      lastCell = op.outOp.outLastSeqNum;
+
+   op.outOp.nCellsTested = startCell;
+   if (startCell >= lastCell)
+      return;
+
+   const unsigned long long int chunkSize = wholeEarthChunkSize;
+   const unsigned long long int nChunks =
+                         (lastCell - startCell + chunkSize - 1) / chunkSize;
+   const int nThreads = op.mainOp.numThreads;
+
+   // bound the number of chunks in memory at once
+   const unsigned long long int window = 4 * nThreads;
+   std::vector< std::vector<DgCellOutput*> > slots(window);
+   std::vector<bool> ready(window, false);
+
+   std::mutex mtx;
+   std::condition_variable chunkReady;  // a chunk has been generated
+   std::condition_variable slotFree;    // a chunk has been written
+   unsigned long long int nextChunk = 0;
+   unsigned long long int nWritten = 0;
+
+   // the workers create the labels themselves, so that a rollover to a new
+   // output file can't change the label state underneath them
+   const DgRFBase* outRF = op.outOp.pOutRF;
+   const bool outSeqNum = op.outOp.outSeqNum;
+   const bool useEnumLbl = op.outOp.useEnumLbl;
+   const char delim = op.outOp.outputDelimiter;
+
+   auto worker = [&] () {
+      // each worker keeps its own cache of shared cell boundary points
+      DgVertexCache vertCache;
+      while (true) {
+         unsigned long long int chunk;
+         {
+            std::unique_lock<std::mutex> lock(mtx);
+            slotFree.wait(lock, [&] {
+                  return nextChunk >= nChunks || nextChunk < nWritten + window; });
+            if (nextChunk >= nChunks)
+               return;
+
+            chunk = nextChunk++;
+         }
+
+         unsigned long long int first = startCell + chunk * chunkSize + 1;
+         unsigned long long int last = first + chunkSize - 1;
+         if (last > lastCell) last = lastCell;
+
+         vertCache.clear();
+
+         std::vector<DgCellOutput*> cells;
+         cells.reserve(last - first + 1);
+         DgLocation* addLoc = dgg.makeLocation(bndRF.addFromSeqNum(first));
+         for (unsigned long long int sn = first; sn <= last; sn++) {
+            std::string label;
+            if (outSeqNum)
+               label = dgg::util::to_string(sn);
+            else if (useEnumLbl)
+               label = dgg::util::to_string(sn - startCell);
+            else {
+               DgLocation tmpLoc(*addLoc);
+               outRF->convert(&tmpLoc);
+               label = tmpLoc.asString(delim);
+            }
+
+            DgCellOutput* out = new DgCellOutput();
+            op.outOp.prepareCellAdd2D(*addLoc, *out, outRF, &label, nullptr,
+                                      &vertCache);
+            cells.push_back(out);
+
+            bndRF.incrementLocation(*addLoc);
+         }
+         delete addLoc;
+
+         {
+            std::lock_guard<std::mutex> lock(mtx);
+            slots[chunk % window].swap(cells);
+            ready[chunk % window] = true;
+         }
+         chunkReady.notify_one();
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; t++)
+      threads.push_back(std::thread(worker));
+
+   // write the chunks in order
+   for (unsigned long long int chunk = 0; chunk < nChunks; chunk++) {
+      std::vector<DgCellOutput*> cells;
+      {
+         std::unique_lock<std::mutex> lock(mtx);
+         chunkReady.wait(lock, [&] { return ready[chunk % window]; });
+         cells.swap(slots[chunk % window]);
+         ready[chunk % window] = false;
+      }
+
+      for (unsigned long i = 0; i < cells.size(); i++) {
+         op.outOp.nCellsAccepted++;
+         op.outOp.nCellsTested++;
+         outputStatus();
+
+         op.outOp.writeCellOutput(*cells[i]);
+         delete cells[i];
+      }
+
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         nWritten++;
+      }
+      slotFree.notify_all();
+   }
+
+   for (unsigned long i = 0; i < threads.size(); i++)
+      threads[i].join();
+
+} // void SubOpGen::genWholeEarthThreaded
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpGen::evalClipBatch (const DgIDGGBase& dgg, int q,
+                         DgQuadClipRegion& clipRegion,
+                         std::vector<DgClipCandidate>& batch)
+//
+// Clip the candidate cells in batch on quad q using op.mainOp.numThreads
+// worker threads, each with its own Clipper, then output the accepted cells
+// in batch order. The cell counts, status messages and output are the same
+// as when evalCell is called on each candidate in turn. Clears batch.
+//
+////////////////////////////////////////////////////////////////////////////////
+{
+   const DgContCartRF& cc1 = dgg.ccFrame();
+   const DgDiscRF2D& grid = dgg.grid2D();
+
+   // the workers claim candidates in small blocks to balance the load
+   const unsigned long int blockSize = 16;
+   std::atomic<unsigned long int> nextBlock(0);
+   std::exception_ptr error;
+   std::mutex errorMtx;
+
+   auto worker = [&] () {
+      ClipperLib::Clipper clipper;
+      try {
+         while (true) {
+            unsigned long int first = blockSize * nextBlock++;
+            if (first >= batch.size())
+               return;
+
+            unsigned long int last = std::min(first + blockSize,
+                                          (unsigned long int) batch.size());
+            for (unsigned long int i = first; i < last; i++) {
+               DgClipCandidate& cand = batch[i];
+               if (cand.preAccepted ||
+                     !dgg.bndRF().bnd2D().validAddressPattern(cand.coord))
+                  continue;
+
+               cand.tested = true;
+               cand.accepted = clipCell(dgg, cc1, grid, clipRegion,
+                             cand.coord, clipper, cand.fields, cand.intersected);
+            }
+         }
+      } catch (...) {
+         std::lock_guard<std::mutex> lock(errorMtx);
+         if (!error)
+            error = std::current_exception();
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < op.mainOp.numThreads; t++)
+      threads.push_back(std::thread(worker));
+
+   for (unsigned long int t = 0; t < threads.size(); t++)
+      threads[t].join();
+
+   if (error)
+      std::rethrow_exception(error);
+
+   // merge the results back in order
+   for (unsigned long int i = 0; i < batch.size(); i++) {
+      DgClipCandidate& cand = batch[i];
+
+      outputStatus();
+
+      if (cand.tested) {
+         op.outOp.nCellsTested++;
+         if (cand.intersected) {
+            nCellsIntersected++;
+            if (cand.accepted) nIntersectedAccepted++;
+         }
+
+         // each point only needs to be found once
+         std::set<DgIVec2D>::iterator it = clipRegion.points().find(cand.coord);
+         if (it != clipRegion.points().end()) {
+            clipRegion.points().erase(it);
+            if (op.outOp.buildShapeFileAttributes)
+               clipRegion.ptFields().erase(cand.coord);
+         }
+      }
+
+      if (!cand.preAccepted && !cand.accepted) continue;
+
+      op.outOp.nCellsAccepted++;
+      op.outOp.curFields.insert(cand.fields.begin(), cand.fields.end());
+
+      DgLocation* addLoc = dgg.makeLocation(DgQ2DICoord(q, cand.coord));
+      op.outOp.outputCellAdd2D(*addLoc);
+      delete addLoc;
+   }
+
+   batch.clear();
+
+} // void SubOpGen::evalClipBatch
+
+////////////////////////////////////////////////////////////////////////////////
+int
+SubOpGen::classifyClipBlock (DgClipBlockData& data, const DgIVec2D& lLeft,
+                    const DgIVec2D& uRight, std::set<DgDBFfield>& fields) const
+//
+// Classify the block of cells from lLeft to uRight. Returns 1 if every cell
+// in the block is accepted (adding the fields of the clipping polygons to
+// fields), 0 if none are, or -1 if the block must be subdivided.
+//
+////////////////////////////////////////////////////////////////////////////////
+{
+   // blocks with points in them need to be evaluated cell by cell
+   const std::set<DgIVec2D>& points = data.clipRegion.points();
+   std::set<DgIVec2D>::const_iterator it = points.lower_bound(lLeft);
+   while (it != points.end() && it->i() <= uRight.i()) {
+      if (it->j() < lLeft.j())
+         it = points.lower_bound(DgIVec2D(it->i(), lLeft.j()));
+      else if (it->j() > uRight.j())
+         it = points.lower_bound(DgIVec2D(it->i() + 1, lLeft.j()));
+      else
+         return -1;
+   }
+
+   if (!doPolyIntersect) return 0;
+
+   // the block's bounding box from its corner cells
+   long double minx = std::numeric_limits<long double>::max();
+   long double miny = std::numeric_limits<long double>::max();
+   long double maxx = -std::numeric_limits<long double>::max();
+   long double maxy = -std::numeric_limits<long double>::max();
+   const long long int ci[2] = { lLeft.i(), uRight.i() };
+   const long long int cj[2] = { lLeft.j(), uRight.j() };
+   for (int a = 0; a < 2; a++) {
+      for (int b = 0; b < 2; b++) {
+         long double x = data.c0.x() + ci[a] * data.di.x() + cj[b] * data.dj.x();
+         long double y = data.c0.y() + ci[a] * data.di.y() + cj[b] * data.dj.y();
+         minx = std::min(minx, x);
+         miny = std::min(miny, y);
+         maxx = std::max(maxx, x);
+         maxy = std::max(maxy, y);
+      }
+   }
+
+   const ClipperLib::IntPoint boxMin(
+         (ClipperLib::cInt) std::floor(minx - data.rx) - 2,
+         (ClipperLib::cInt) std::floor(miny - data.ry) - 2);
+   const ClipperLib::IntPoint boxMax(
+         (ClipperLib::cInt) std::ceil(maxx + data.rx) + 2,
+         (ClipperLib::cInt) std::ceil(maxy + data.ry) + 2);
+
+   bool accepted = false;
+   for (unsigned int i = 0; i < data.clipRegion.clpPolys().size(); i++) {
+      const DgClippingPoly& clipPoly = data.clipRegion.clpPolys()[i];
+
+      DgClipRaster::DgTileClass cls = clipPoly.raster.classify(boxMin, boxMax);
+      if (cls == DgClipRaster::Outside) continue;
+      if (cls == DgClipRaster::Boundary) return -1;
+
+#ifdef USE_GDAL
+      // cells may fall in holes
+      if (useHoles && !clipPoly.holes.empty()) return -1;
+#endif
+
+      accepted = true;
+      if (op.outOp.buildShapeFileAttributes) {
+         const std::set<DgDBFfield>& polyFields = data.clipRegion.polyFields()[i];
+         fields.insert(polyFields.begin(), polyFields.end());
+      } else // only need one intersection
+         break;
+   }
+
+   return (accepted) ? 1 : 0;
+
+} // int SubOpGen::classifyClipBlock
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpGen::refineClipBlock (DgClipBlockData& data, const DgIVec2D& lLeft,
+                           const DgIVec2D& uRight)
+//
+// Add the accepted cells in the block from lLeft to uRight to data.cells,
+// subdividing the block as needed. Cells are counted as tested as in the
+// row by row scan: every valid cell is, other than the overage cells.
+//
+////////////////////////////////////////////////////////////////////////////////
+{
+   const DgBoundedRF2D& bnd2D = data.dgg.bndRF().bnd2D();
+
+   std::set<DgDBFfield> fields;
+   int cls = classifyClipBlock(data, lLeft, uRight, fields);
+   if (cls == 0) {
+
+      // reject the entire block
+      for (long long int i = lLeft.i(); i <= uRight.i(); i++) {
+         for (long long int j = lLeft.j(); j <= uRight.j(); j++) {
+            DgIVec2D coord(i, j);
+            if (bnd2D.validAddressPattern(coord) && !data.isOverage(coord))
+               op.outOp.nCellsTested++;
+         }
+      }
+
+      return;
+   }
+
+   if (cls == 1) {
+
+      // accept the entire block
+      int fieldsNdx = -1;
+      if (op.outOp.buildShapeFileAttributes) {
+         fieldsNdx = (int) data.cellFields.size();
+         data.cellFields.push_back(fields);
+      }
+
+      for (long long int i = lLeft.i(); i <= uRight.i(); i++) {
+         for (long long int j = lLeft.j(); j <= uRight.j(); j++) {
+            DgIVec2D coord(i, j);
+            if (!bnd2D.validAddressPattern(coord) || data.isOverage(coord))
+               continue;
+
+            op.outOp.nCellsTested++;
+            data.cells.push_back(std::make_pair(coord, fieldsNdx));
+         }
+      }
+
+      return;
+   }
+
+   if (lLeft == uRight) {
+
+      // evaluate the individual cell; overage cells are output untested
+      if (!bnd2D.validAddressPattern(lLeft) || data.isOverage(lLeft)) return;
+
+      op.outOp.nCellsTested++;
+
+      ClipperLib::Clipper clipper;
+      bool intersected = false;
+      bool accepted = clipCell(data.dgg, data.dgg.ccFrame(), data.dgg.grid2D(),
+                         data.clipRegion, lLeft, clipper, fields, intersected);
+      if (intersected) {
+         nCellsIntersected++;
+         if (accepted) nIntersectedAccepted++;
+      }
+
+      // each point only needs to be found once
+      std::set<DgIVec2D>::iterator it = data.clipRegion.points().find(lLeft);
+      if (it != data.clipRegion.points().end()) {
+         data.clipRegion.points().erase(it);
+         if (op.outOp.buildShapeFileAttributes)
+            data.clipRegion.ptFields().erase(lLeft);
+      }
+
+      if (!accepted) return;
+
+      int fieldsNdx = -1;
+      if (op.outOp.buildShapeFileAttributes) {
+         fieldsNdx = (int) data.cellFields.size();
+         data.cellFields.push_back(fields);
+      }
+
+      data.cells.push_back(std::make_pair(lLeft, fieldsNdx));
+      return;
+   }
+
+   // split the longer side of the block in half
+   if (uRight.i() - lLeft.i() >= uRight.j() - lLeft.j()) {
+      long long int mid = lLeft.i() + (uRight.i() - lLeft.i()) / 2;
+      refineClipBlock(data, lLeft, DgIVec2D(mid, uRight.j()));
+      refineClipBlock(data, DgIVec2D(mid + 1, lLeft.j()), uRight);
+   } else {
+      long long int mid = lLeft.j() + (uRight.j() - lLeft.j()) / 2;
+      refineClipBlock(data, lLeft, DgIVec2D(uRight.i(), mid));
+      refineClipBlock(data, DgIVec2D(lLeft.i(), mid + 1), uRight);
+   }
+
+} // void SubOpGen::refineClipBlock
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpGen::genClipQuadHierarchical (const DgIDGGBase& dgg, int q,
+                  DgQuadClipRegion& clipRegion, std::set<DgIVec2D>& overageSet)
+//
+// Generate the clipped cells on quad q by recursively subdividing the quad
+// bounding box into blocks of cells. Blocks entirely inside or outside of
+// each clipping polygon are accepted or rejected without testing their
+// cells individually. The box is processed in bands of rows so that the
+// accepted cells, merged with the overage cells, are output in the same
+// order as the row by row scan.
+//
+////////////////////////////////////////////////////////////////////////////////
+{
+   const DgContCartRF& cc1 = dgg.ccFrame();
+   const DgDiscRF2D& grid = dgg.grid2D();
+   const DgIVec2D lLeft = clipRegion.offset();
+   const DgIVec2D uRight = clipRegion.upperRight();
+
+   DgClipBlockData data(dgg, clipRegion, overageSet);
+
+   // the cell centers are an affine function of the cell i, j; use cells
+   // two apart so that any alternating cell orientations (as in triangle
+   // grids) don't affect the fit
+   DgDVec2D cen[3];
+   const DgIVec2D ref[3] = { lLeft, lLeft + DgIVec2D(2, 0), lLeft + DgIVec2D(0, 2) };
+   for (int k = 0; k < 3; k++) {
+      DgLocation* loc = grid.makeLocation(ref[k]);
+      cc1.convert(loc);
+      cen[k] = *cc1.getAddress(*loc) * clipperFactor;
+      delete loc;
+   }
+
+   data.di = (cen[1] - cen[0]) * 0.5L;
+   data.dj = (cen[2] - cen[0]) * 0.5L;
+   data.c0 = cen[0] - data.di * lLeft.i() - data.dj * lLeft.j();
+
+   // find the extent of the cell vertices from the fitted centers over
+   // each cell orientation
+   for (long long int i = lLeft.i(); i < lLeft.i() + 2; i++) {
+      for (long long int j = lLeft.j(); j < lLeft.j() + 2; j++) {
+         const DgDVec2D c = data.c0 + data.di * i + data.dj * j;
+
+         DgPolygon verts;
+         grid.setVertices(DgIVec2D(i, j), verts);
+         cc1.convert(verts);
+         for (int v = 0; v < verts.size(); v++) {
+            const DgDVec2D p = *cc1.getAddress(verts[v]) * clipperFactor;
+            data.rx = std::max(data.rx, std::fabs(p.x() - c.x()));
+            data.ry = std::max(data.ry, std::fabs(p.y() - c.y()));
+         }
+      }
+   }
+
+   // allow for rounding
+   data.rx = data.rx * 1.001L + 2.0L;
+   data.ry = data.ry * 1.001L + 2.0L;
+
+   const long long int bandRows = 64;
+   for (long long int i0 = lLeft.i(); i0 <= uRight.i(); i0 += bandRows) {
+
+      const long long int i1 = std::min(i0 + bandRows - 1, uRight.i());
+
+      data.cells.clear();
+      data.cellFields.clear();
+      refineClipBlock(data, DgIVec2D(i0, lLeft.j()), DgIVec2D(i1, uRight.j()));
+      std::sort(data.cells.begin(), data.cells.end());
+
+      for (const auto& cell: data.cells) {
+
+         // output any overage cells that come first; the overage cells
+         // were left out of data.cells
+         while (!overageSet.empty() && *overageSet.begin() < cell.first) {
+            DgIVec2D coord = *overageSet.begin();
+            overageSet.erase(overageSet.begin());
+
+            outputStatus();
+            op.outOp.nCellsAccepted++;
+            DgLocation* addLoc = dgg.makeLocation(DgQ2DICoord(q, coord));
+            op.outOp.outputCellAdd2D(*addLoc);
+            delete addLoc;
+         }
+
+         outputStatus();
+         op.outOp.nCellsAccepted++;
+         if (cell.second >= 0) {
+            const std::set<DgDBFfield>& fields = data.cellFields[cell.second];
+            op.outOp.curFields.insert(fields.begin(), fields.end());
+         }
+
+         DgLocation* addLoc = dgg.makeLocation(DgQ2DICoord(q, cell.first));
+         op.outOp.outputCellAdd2D(*addLoc);
+         delete addLoc;
+      }
+   }
+
+   // output the remaining overage cells
+   while (!overageSet.empty()) {
+      DgIVec2D coord = *overageSet.begin();
+      overageSet.erase(overageSet.begin());
+
+      outputStatus();
+      op.outOp.nCellsAccepted++;
+      DgLocation* addLoc = dgg.makeLocation(DgQ2DICoord(q, coord));
+      op.outOp.outputCellAdd2D(*addLoc);
+      delete addLoc;
+   }
+
+} // void SubOpGen::genClipQuadHierarchical
+
 ////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 ClipperLib::Paths*
@@ -1009,6 +1642,8 @@ SubOpGen::createClipRegions (const DgIDGGBase& dgg,
              DgQuadClipRegion clipRegions[], std::set<DgIVec2D> overageSet[],
              std::map<DgIVec2D, std::set<DgDBFfield> > overageFields[])
 {
+   DgProfileScope prof(DgRunProfile::ClipRegions);
+
    dgcout << "\n* building clipping regions..." << std::endl;
 
    // initialize the i,j bounds
@@ -1376,6 +2011,19 @@ SubOpGen::createClipRegions (const DgIDGGBase& dgg,
       }
    }
 
+   //// build the rasters used to avoid most clipper intersections ////
+
+   // tiles of about two cells per side; quads are about maxI + 1 cells wide
+   const ClipperLib::cInt tileSize =
+               (ClipperLib::cInt) (2.0L * clipperFactor / (dgg.maxI() + 1));
+   for (int q = 1; q < 11; q++) {
+      for (auto& clipPoly: clipRegions[q].clpPolys())
+         clipPoly.raster.build(clipPoly.exterior, tileSize);
+   }
+
+   // the prototype cells used to generate candidate cell boundaries
+   cellTemplate.build(dgg);
+
    //////// now do a quad at a time ///////
 
    // look for possible overage
@@ -1383,6 +2031,8 @@ SubOpGen::createClipRegions (const DgIDGGBase& dgg,
    op.outOp.nCellsTested = 0;
    op.outOp.nCellsAccepted = 0;
    op.dggOp.nSamplePts = 0;
+   nCellsIntersected = 0;
+   nIntersectedAccepted = 0;
 
    const DgContCartRF& cc1 = dgg.ccFrame();
    const DgDiscRF2D& grid = dgg.grid2D();
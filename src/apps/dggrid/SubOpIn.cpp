@@ -22,11 +22,14 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <dglib/DgGeoSphRF.h>
+#include <dglib/DgIDGGBase.h>
 #include <dglib/DgLocation.h>
 #include <dglib/DgInLocTextFile.h>
 #include <dglib/DgInGdalFile.h>
 //#include <dglib/DgHierNdxSysType.h>
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 #include "SubOpBasicMulti.h"
 #include "SubOpIn.h"
@@ -245,7 +248,10 @@ SubOpIn::makeNewInFile (const DgRFBase& rfIn, const std::string* fileNameIn,
 {
    DgInLocStreamFile* newFile = nullptr;
    if (pointInputFileType == "TEXT") {
-     newFile = new DgInLocTextFile(rfIn, fileNameIn, failLevel);
+     // read the file in place if possible
+     DgInLocTextFile* textFile = new DgInLocTextFile(rfIn, fileNameIn, failLevel);
+     textFile->mapFile();
+     newFile = textFile;
 #ifdef USE_GDAL
    } else if (pointInputFileType == "GDAL") {
       newFile = new DgInGdalFile (rfIn, fileNameIn, failLevel);
@@ -259,6 +265,88 @@ SubOpIn::makeNewInFile (const DgRFBase& rfIn, const std::string* fileNameIn,
 
 } // DgInLocStreamFile* SubOpIn::makeNewInFile
 
+////////////////////////////////////////////////////////////////////////////////
+bool
+SubOpIn::nextInFile (void) {
+
+   // if we're here we're at EOF on the current file
+   inFile->close();
+   delete inFile;
+   inFile = nullptr;
+
+   // try to go to the next file
+   fileNum++;
+   if (fileNum >= inputFiles.size())
+      return false; // at EOF on last file
+
+   inTextFileName = inputFiles[fileNum];
+   inFile = makeNewInFile(*pInRF, &inTextFileName, DgBase::Fatal);
+
+   return true;
+
+} // bool SubOpIn::nextInFile
+
+////////////////////////////////////////////////////////////////////////////////
+DgInLocTextFile*
+SubOpIn::mappedInFile (void) const {
+
+   if (!inFile || !isPointInput || pointInputFileType != "TEXT")
+      return nullptr;
+
+   DgInLocTextFile* textFile = static_cast<DgInLocTextFile*>(inFile);
+   return (textFile->isMapped()) ? textFile : nullptr;
+
+} // DgInLocTextFile* SubOpIn::mappedInFile
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+SubOpIn::getNextLine (const char*& begin, const char*& end) {
+
+   // currently only works on text point files
+   if (!isPointInput || pointInputFileType != "TEXT")
+      return false;
+
+   // executeOp should have been called
+   if (!inFile)
+      return false;
+
+   while (1) {
+      DgInLocTextFile* textFile = mappedInFile();
+      if (textFile) {
+         if (textFile->nextLine(begin, end))
+            return true;
+      } else {
+         // getline leaves the string unchanged if it fails at EOF
+         lineBuf.clear();
+         std::getline(*inFile, lineBuf);
+         // the last line need not be terminated
+         if (!inFile->eof() || !lineBuf.empty()) {
+            begin = lineBuf.data();
+            end = begin + lineBuf.size();
+            return true;
+         }
+      }
+
+      if (!nextInFile())
+         return false;
+   }
+
+} // bool SubOpIn::getNextLine
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+SubOpIn::getNextLine (std::string& line) {
+
+   const char* begin = nullptr;
+   const char* end = nullptr;
+   if (!getNextLine(begin, end))
+      return false;
+
+   line.assign(begin, end);
+   return true;
+
+} // bool SubOpIn::getNextLine
+
 ////////////////////////////////////////////////////////////////////////////////
 DgLocationData*
 SubOpIn::getNextLoc (void) {
@@ -273,44 +361,29 @@ SubOpIn::getNextLoc (void) {
    if (!inFile)
       return loc;
 
-   while (1) {
-      if (pointInputFileType == "TEXT") {
-         const int maxLine = 2056;
-         char buff[maxLine];
-         inFile->getline(buff, maxLine);
-         if (!inFile->eof()) {  // we have an input line
-            loc = op.primarySubOp->inStrToPointLoc(buff);
-            break;
-         }
-      } else if (pointInputFileType == "GDAL") {
+   if (pointInputFileType == "TEXT") {
+      const char* begin = nullptr;
+      const char* end = nullptr;
+      if (getNextLine(begin, end))
+         loc = op.primarySubOp->inStrToPointLoc(begin, end);
+   } else if (pointInputFileType == "GDAL") {
+      while (1) {
          loc = new DgLocationData();
          *inFile >> *loc;
 
-         if (!inFile->eof()) {  // we have an input line
+         if (!inFile->eof())  // we have an input line
             break;
-         } else { // eof so loc is invalid
-            delete loc;
-            loc = nullptr;
-         }
-      } else {
-         ::report("SubOpIn::getNextLoc(): invalid point input file type " +
-                   pointInputFileType, DgBase::Fatal);
-      }
 
-      // if we're here we're at EOF
-      inFile->close();
-      delete inFile;
-      inFile = nullptr;
+         // eof so loc is invalid
+         delete loc;
+         loc = nullptr;
 
-      // try to go to the next file
-      fileNum++;
-      if (fileNum < inputFiles.size()) {
-         // open next file and try to read again
-         inTextFileName = inputFiles[fileNum];
-         inFile = makeNewInFile(*pInRF, &inTextFileName, DgBase::Fatal);
-      } else { // at EOF on last file
-        break;
+         if (!nextInFile())
+            break;
       }
+   } else {
+      ::report("SubOpIn::getNextLoc(): invalid point input file type " +
+                pointInputFileType, DgBase::Fatal);
    }
 
 #if DGDEBUG
@@ -320,6 +393,25 @@ SubOpIn::getNextLoc (void) {
 
 } // DgLocationData* SubOpIn::getNextLoc
 
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+SubOpIn::quantifyLoc (DgLocation& loc) const {
+
+   DgProfileScope prof(DgRunProfile::Projection);
+
+   const DgIDGGBase& dgg = op.dggOp.dgg();
+
+   const DgGeoSphDegRF& deg = op.dggOp.deg();
+   if (loc.rf() == deg) {
+      const DgDVec2D& pt = *deg.getAddress(loc);
+      return dgg.quantify(DgGeoCoord(pt.x(), pt.y(), false));
+   }
+
+   dgg.convert(&loc);
+   return *dgg.getAddress(loc);
+
+} // DgQ2DICoord SubOpIn::quantifyLoc
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 SubOpIn::resetInFile (void) {
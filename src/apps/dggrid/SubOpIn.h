@@ -30,8 +30,10 @@
 #include "SubOpBasic.h"
 
 struct OpBasic;
+class DgLocation;
 class DgLocationData;
-//class DgInLocTextFile;
+class DgQ2DICoord;
+class DgInLocTextFile;
 class DgInLocStreamFile;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -54,7 +56,24 @@ struct SubOpIn : public SubOpBasic {
    // returns nullptr if no more input lines to read
    DgLocationData* getNextLoc (void);
 
+   // reads the next raw line from the TEXT point input files, advancing
+   // through the input files as needed; returns false at EOF on the last file
+   bool getNextLine (std::string& line);
+
+   // as above but sets [begin, end) to the line in place when the input
+   // file is memory mapped; the line is valid until the next call
+   bool getNextLine (const char*& begin, const char*& end);
+
+   // the current input file if it is a memory mapped TEXT file, otherwise
+   // nullptr
+   DgInLocTextFile* mappedInFile (void) const;
+
+   // returns the dgg address of an input location; GEO input points are
+   // quantified directly, other locations are converted to the dgg in place
+   DgQ2DICoord quantifyLoc (DgLocation& loc) const;
+
    // internal helper methods
+   bool nextInFile (void); // returns false if there are no more files
    DgInLocStreamFile* makeNewInFile (const DgRFBase& rfIn,
                      const std::string* fileNameIn = nullptr,
                      DgBase::DgReportLevel failLevel = DgBase::Fatal);
@@ -70,6 +89,7 @@ struct SubOpIn : public SubOpBasic {
    dgg::addtype::DgHierNdxSysType inHierNdxSysType;
    dgg::addtype::DgHierNdxFormType inHierNdxFormType;
    const DgHierNdxSystemRFSBase* hierNdxSystem;
+   std::string lineBuf;     // holds lines read from unmapped input files
 
    bool isPointInput;
    std::string pointInputFileType;
@@ -25,6 +25,7 @@
 #include <dglib/DgConstants.h>
 #include <dglib/DgConverterBase.h>
 
+#include "DgRunProfile.h"
 #include "SubOpMain.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -32,7 +33,8 @@ SubOpMain::SubOpMain (OpBasic& op, bool _activate)
    : SubOpBasic (op, _activate),
      operation (""), precision (DEFAULT_PRECISION), verbosity (0),
      megaVerbose (false), pauseOnStart (false), pauseBeforeExit (false),
-     useMother(false), updateFreq (100000)
+     useMother(false), updateFreq (100000), numThreads (1),
+     profileFileName ("")
 {
 }
 
@@ -64,6 +66,12 @@ SubOpMain::initializeOp (void)
    //  update_frequency <int> (v >= 0)
    pList().insertParam(new DgULIntParam("update_frequency", 100000, 0, ULONG_MAX, true));
 
+   //  num_threads <int> (1 <= v <= 256)
+   pList().insertParam(new DgIntParam("num_threads", 1, 1, 256));
+
+   // profile_output_file <fileName> (empty for no profiling)
+   pList().insertParam(new DgStringParam("profile_output_file", ""));
+
    return 0;
 
 } // int SubOpMain::initializeOp
@@ -96,6 +104,16 @@ SubOpMain::setupOp (void)
 
    getParamValue(pList(), "update_frequency", updateFreq, false);
 
+   getParamValue(pList(), "num_threads", numThreads, false);
+   if (numThreads > 1 && megaVerbose) {
+      ::report("num_threads > 1 is not supported with verbosity 3; "
+               "using a single thread", DgBase::Warning);
+      numThreads = 1;
+   }
+
+   getParamValue(pList(), "profile_output_file", profileFileName, false);
+   DgRunProfile::setEnabled(!profileFileName.empty());
+
    return 0;
 
 } // SubOpMain::setupOp
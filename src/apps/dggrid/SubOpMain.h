@@ -45,6 +45,8 @@ struct SubOpMain : public SubOpBasic {
       bool pauseBeforeExit;
       bool useMother;         // use Mother RNG?
       unsigned long int updateFreq; // how often to output updates
+      int numThreads;         // number of worker threads to use
+      std::string profileFileName; // JSON run profile; empty for none
 
       // DgApSubOperation virtual methods that use the pList
       virtual int initializeOp (void);
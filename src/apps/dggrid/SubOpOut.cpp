@@ -67,6 +67,7 @@
 #include <dglib/DgHierNdxSystemRFSBase.h>
 #include "DgHexSF.h"
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 #include "SubOpOut.h"
 
@@ -241,10 +242,29 @@ SubOpOut::genRandPts (const DgQ2DICoord& add2D, const std::string& label)
 
 } // void SubOpOut::genRandPts
 
+////////////////////////////////////////////////////////////////////////////////
+DgCellOutput::~DgCellOutput (void)
+{
+   delete cell;
+
+} // DgCellOutput::~DgCellOutput
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
                DgDataList* dataList)
+{
+   DgCellOutput out;
+   prepareCellAdd2D(add2D, out, pOutRF, labelIn, dataList, &vertCache);
+   writeCellOutput(out, dataList);
+
+} // void SubOpOut::outputCellAdd2D
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpOut::prepareCellAdd2D (const DgLocation& add2D, DgCellOutput& out,
+               const DgRFBase* outRF, const std::string* labelIn,
+               DgDataList* dataList, DgVertexCache* vertCache) const
 {
    const DgIDGGBase& dgg = op.dggOp.dgg();
 
@@ -260,21 +280,26 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
          label = dgg::util::to_string(nCellsAccepted);
       else {
          DgLocation tmpLoc(add2D);
-         pOutRF->convert(&tmpLoc);
+         outRF->convert(&tmpLoc);
          label = tmpLoc.asString(outputDelimiter);
       }
    }
 
-   // start new files if needed
-   if (maxCellsPerFile && nCellsOutputToFile >= maxCellsPerFile)
-      execute(true);
-
-   nCellsOutputToFile++;
+   out.add2D = add2D;
 
-   DgLocation* tmpLoc = new DgLocation(add2D);
+   // the cell center point in the geoRF
+   DgLocation* tmpLoc = nullptr;
+   {
+      DgProfileScope prof(DgRunProfile::Projection);
+      tmpLoc = dgg.geoRF().makeLocation(
+                  dgg.invQuantify(*dgg.getAddress(add2D)));
+   }
 
    DgPolygon verts(dgg);
-   dgg.setVertices(add2D, verts, op.outOp.nDensify);
+   {
+      DgProfileScope prof(DgRunProfile::Vertices);
+      dgg.setVertices(add2D, verts, op.outOp.nDensify, vertCache);
+   }
 
    // unwrap the cell east/west if applicable
    DgPolygon* unwrappedVerts = new DgPolygon(verts);
@@ -284,7 +309,6 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
 
    // wrap the cell center point if the boundary was wrapped
    if (unwrapPts && wrapped) {
-      dgg.geoRF().convert(tmpLoc);
       DgGeoCoord g = *(dgg.geoRF().getAddress(*tmpLoc));
       int testWrap = DgGeoSphRF::lonWrap(g, lonWrapMode);
       if (testWrap) {
@@ -294,7 +318,9 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
    }
 
    // create the cell to output
-   DgCell cell(dgg.geoRF(), label, *tmpLoc, unwrappedVerts, dataList, false);
+   delete out.cell;
+   out.cell = new DgCell(dgg.geoRF(), label, *tmpLoc, unwrappedVerts, dataList, false);
+   const DgCell& cell = *out.cell;
 
    // output cell area
 //  dgg.geoRF().convert(tmpLoc);
@@ -307,14 +333,81 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
 
    delete tmpLoc;
 
+   ///// neighbor/children output /////
+   const DgLocation& ctrGeo = cell.node();
+   //if (nbrOut || neighborOutType == "GDAL_COLLECTION")
+   if (neighborsOutType != "NONE") {
+
+      if (dgg.gridTopo() == Triangle)
+         ::report("Neighbors not implemented for Triangle grids", DgBase::Fatal);
+
+      dgg.setNeighbors(add2D, out.neighbors);
+
+      out.nbrDists.resize(out.neighbors.size());
+      for (int i = 0; i < out.neighbors.size(); i++)
+         out.nbrDists[i] = dgg.geoRF().dist(ctrGeo, out.neighbors[i]);
+   }
+
+   // spatial children
+   //const DgHexIDGG& hexdgg = static_cast<const DgHexIDGG&>(dgg);
+   const DgQ2DICoord& q2di = *dgg.getAddress(add2D);
+   DgResAdd<DgQ2DICoord> q2diR(q2di, dgg.res());
+   if (childrenOutType != "NONE")
+      op.dggOp.dggs().setAllChildren(q2diR, out.children);
+
+   // indexing parent
+   const DgHierNdxSystemRFSBase* hierNdxSystem = op.dggOp.dggs().hierNdxSystem();
+   if (ndxParentOutType != "NONE") {
+      if (!hierNdxSystem) {
+          ::report("indexing parents require a hierarchical indexing system.", DgBase::Fatal);
+      }
+
+      hierNdxSystem->setNdxParent(q2diR, out.ndxParent);
+   }
+
+/*
+        const DgHierNdxSystemRFBase& hierRF = hierNdxSystem->sysRF(dgg.res());
+        hierRF.setAllChildren(q2diR, children);
+  */
+
+   // indexing children
+   if (ndxChildrenOutType != "NONE") {
+       if (!hierNdxSystem) {
+           ::report("indexing parents require a hierarchical indexing system.", DgBase::Fatal);
+       }
+
+       hierNdxSystem->setNdxChildren(q2diR, out.ndxChildren);
+   }
+
+} // void SubOpOut::prepareCellAdd2D
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpOut::writeCellOutput (DgCellOutput& out, DgDataList* dataList)
+{
+   DgProfileScope profTotal(DgRunProfile::OutTotal);
+
+   const DgIDGGBase& dgg = op.dggOp.dgg();
+   const DgLocation& add2D = out.add2D;
+   DgCell& cell = *out.cell;
+   const std::string& label = cell.label();
+
+   // start new files if needed
+   if (maxCellsPerFile && nCellsOutputToFile >= maxCellsPerFile)
+      execute(true);
+
+   nCellsOutputToFile++;
+
    if (op.mainOp.megaVerbose)
       dgcout << "accepted " << label << " " << add2D << newline;
 
-   if (dataOut)
+   if (dataOut) {
+      DgProfileScope prof(DgRunProfile::OutData);
       *dataOut << label << op.primarySubOp->dataToOutStr(dataList) << newline;
+   }
 
-   const DgQ2DICoord& q2di = *dgg.getAddress(add2D);
    if (cellOut) {
+      DgProfileScope prof(DgRunProfile::OutCell);
       if (op.mainOp.megaVerbose)
          dgcout << "outputting region: " << cell << newline;
 
@@ -329,6 +422,7 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
    }
 	
    if (ptOut) {
+      DgProfileScope prof(DgRunProfile::OutPoint);
       if (op.mainOp.megaVerbose)
          dgcout << "outputting point: " << cell << newline;
 
@@ -339,72 +433,48 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
    }
 
    ///// generate random points if applicable ///
-   if (doRandPts)
+   if (doRandPts) {
+      DgProfileScope prof(DgRunProfile::OutRandPts);
       genRandPts(*dgg.getAddress(add2D), cell.label());
+   }
 
    ///// neighbor/children output files /////
-   DgLocVector neighbors;
-   DgLocation ctrGeo = cell.node();
-   //if (nbrOut || neighborOutType == "GDAL_COLLECTION")
    if (neighborsOutType != "NONE") {
+      if (nbrOut) {
+         DgProfileScope prof(DgRunProfile::OutNeighbors);
+         nbrOut->insert(add2D, out.neighbors);
+      }
 
-      if (dgg.gridTopo() == Triangle)
-         ::report("Neighbors not implemented for Triangle grids", DgBase::Fatal);
-
-      dgg.setNeighbors(add2D, neighbors);
-      if (nbrOut)
-         nbrOut->insert(add2D, neighbors);
-
-      for (int i = 0; i < neighbors.size(); i++)
-         runStats.push(dgg.geoRF().dist(ctrGeo, neighbors[i]));
+      for (unsigned long i = 0; i < out.nbrDists.size(); i++)
+         runStats.push(out.nbrDists[i]);
    }
 
    // spatial children
-   //const DgHexIDGG& hexdgg = static_cast<const DgHexIDGG&>(dgg);
-   DgResAdd<DgQ2DICoord> q2diR(q2di, dgg.res());
-   DgLocVector children;
    if (childrenOutType != "NONE") {
-
-      op.dggOp.dggs().setAllChildren(q2diR, children);
-
-      if (chdOut)
-         chdOut->insert(add2D, children);
+      if (chdOut) {
+         DgProfileScope prof(DgRunProfile::OutChildren);
+         chdOut->insert(add2D, out.children);
+      }
    }
 
    // indexing parent
-   const DgHierNdxSystemRFSBase* hierNdxSystem = op.dggOp.dggs().hierNdxSystem();
-   DgLocation ndxParent;
    if (ndxParentOutType != "NONE") {
-      if (!hierNdxSystem) {
-          ::report("indexing parents require a hierarchical indexing system.", DgBase::Fatal);
+      if (ndxPrtOut) {
+         DgProfileScope prof(DgRunProfile::OutNdxParent);
+         ndxPrtOut->insert(add2D, out.ndxParent);
       }
-
-      hierNdxSystem->setNdxParent(q2diR, ndxParent);
-
-      if (ndxPrtOut)
-         ndxPrtOut->insert(add2D, ndxParent);
    }
 
-/*
-        const DgHierNdxSystemRFBase& hierRF = hierNdxSystem->sysRF(dgg.res());
-        hierRF.setAllChildren(q2diR, children);
-  */
-
    // indexing children
-   // reuse variables from the spatial children above
-   DgLocVector ndxChildren;
    if (ndxChildrenOutType != "NONE") {
-       if (!hierNdxSystem) {
-           ::report("indexing parents require a hierarchical indexing system.", DgBase::Fatal);
+       if (ndxChdOut) {
+           DgProfileScope prof(DgRunProfile::OutNdxChildren);
+           ndxChdOut->insert(add2D, out.ndxChildren);
        }
-
-       hierNdxSystem->setNdxChildren(q2diR, ndxChildren);
-
-       if (ndxChdOut)
-           ndxChdOut->insert(add2D, ndxChildren);
    }
 
    if (collectOut) {
+      DgProfileScope prof(DgRunProfile::OutCollection);
       collectOut->insert(dgg, cell,
             (pointOutType == "GDAL_COLLECTION"),
             (cellOutType == "GDAL_COLLECTION"),
@@ -412,13 +482,13 @@ SubOpOut::outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn,
             ((outSeqNum || useEnumLbl) ? NULL : pOutRF),
             ((outSeqNum || useEnumLbl) ? NULL : pChdOutRF),
             ((outSeqNum || useEnumLbl) ? NULL : pPrtOutRF),
-            ((neighborsOutType == "GDAL_COLLECTION") ? &neighbors : nullptr),
-            ((childrenOutType == "GDAL_COLLECTION") ? &children : nullptr),
-            ((ndxParentOutType == "GDAL_COLLECTION") ? &ndxParent : nullptr),
-            ((ndxChildrenOutType == "GDAL_COLLECTION") ? &ndxChildren : nullptr));
+            ((neighborsOutType == "GDAL_COLLECTION") ? &out.neighbors : nullptr),
+            ((childrenOutType == "GDAL_COLLECTION") ? &out.children : nullptr),
+            ((ndxParentOutType == "GDAL_COLLECTION") ? &out.ndxParent : nullptr),
+            ((ndxChildrenOutType == "GDAL_COLLECTION") ? &out.ndxChildren : nullptr));
    }
 
-} // void SubOpOut::outputCell
+} // void SubOpOut::writeCellOutput
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -432,7 +502,7 @@ SubOpOut::SubOpOut (OpBasic& op, bool _activate)
      outSeqNum (false), outputDelimiter (' '), nDensify (1),
      lonWrapMode (DgGeoSphRF::Wrap), unwrapPts (true),
      doRandPts (true), ptsRand (0), nRandPts (0),
-     nCellsTested(0), nCellsAccepted (0),
+     nCellsTested(0), nCellsAccepted (0), gdalTransactionBatchSize (0),
      dataOut (0), cellOut (0), ptOut (0), collectOut (0), randPtsOut (0),
      cellOutShp (0), ptOutShp (0), prCellOut (0), nbrOut (0), chdOut (0),
      ndxChdOut(0), ndxPrtOut(0),
@@ -534,6 +604,10 @@ SubOpOut::initializeOp (void)
 
    // collection_output_gdal_format <gdal driver type>
    pList().insertParam(new DgStringParam("collection_output_gdal_format", "GeoJSON"));
+
+   // gdal_transaction_batch_size <unsigned long int> (0 for no transactions)
+   pList().insertParam(new DgULIntParam("gdal_transaction_batch_size",
+            DgOutGdalFile::defaultTransactionBatchSize, 0, ULONG_MAX, true));
 #endif
 
    // cell_output_file_name <outputFileName>
@@ -715,6 +789,8 @@ SubOpOut::setupOp (void)
    getParamValue(pList(), "point_output_type", pointOutType, "NONE");
 #ifdef USE_GDAL
    getParamValue(pList(), "point_output_gdal_format", gdalPointDriver, "NONE");
+   getParamValue(pList(), "gdal_transaction_batch_size", gdalTransactionBatchSize,
+                    false);
 #endif
    getParamValue(pList(), "randpts_output_type", randPtsOutType, "NONE");
    getParamValue(pList(), "neighbor_output_type", neighborsOutType, "NONE");
@@ -1012,6 +1088,15 @@ SubOpOut::executeOp (void) {
       }
    }
 
+#ifdef USE_GDAL
+   DgOutLocFile* gdalFiles[] = { collectOut, cellOut, ptOut, randPtsOut };
+   for (auto file: gdalFiles) {
+      DgOutGdalFile* gdalFile = dynamic_cast<DgOutGdalFile*>(file);
+      if (gdalFile)
+         gdalFile->setTransactionBatchSize(gdalTransactionBatchSize);
+   }
+#endif
+
    ///// children/neighbor output files /////
    if (neighborsOutType == "TEXT") {
       if (op.dggOp.gridTopo == Triangle)
@@ -29,6 +29,9 @@
 #include <dglib/DgInShapefileAtt.h>
 #include <dglib/DgAddressType.h>
 #include <dglib/DgRunningStats.h>
+#include <dglib/DgLocation.h>
+#include <dglib/DgLocVector.h>
+#include <dglib/DgVertexCache.h>
 
 #include "SubOpBasic.h"
 
@@ -36,8 +39,8 @@ class DgIDGGSBase;
 class DgIDGGBase;
 class DgQ2DICoord;
 class DgContCartRF;
-class DgLocation;
 class DgPolygon;
+class DgCell;
 class DgOutLocFile;
 class DgOutShapefile;
 class DgOutPRCellsFile;
@@ -51,6 +54,29 @@ class DgDataList;
 
 struct OpBasic;
 
+////////////////////////////////////////////////////////////////////////////////
+// the geometry and topology of a single output cell; this is everything
+// that can be calculated for a cell independent of the output files, so that
+// it can be generated by worker threads ahead of being written in order
+struct DgCellOutput {
+
+   DgCellOutput (void) : cell (nullptr) { }
+  ~DgCellOutput (void);
+
+   DgLocation add2D;    // the cell address in the dgg
+   DgCell* cell;        // label, center point, and boundary
+   DgLocVector neighbors;
+   std::vector<long double> nbrDists; // distances from center to neighbors
+   DgLocVector children;
+   DgLocation ndxParent;
+   DgLocVector ndxChildren;
+
+   private:
+
+      DgCellOutput (const DgCellOutput&);
+      DgCellOutput& operator= (const DgCellOutput&);
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 struct SubOpOut : public SubOpBasic {
 
@@ -68,6 +94,16 @@ struct SubOpOut : public SubOpBasic {
    void outputCellAdd2D (const DgLocation& add2D, const std::string* labelIn = nullptr,
                DgDataList* dataList = nullptr);
 
+   // outputCellAdd2D split into its calculation and output halves;
+   // prepareCellAdd2D does not change any state of this object and may be
+   // called concurrently, given an output RF that is not changing underneath
+   // it and a separate vertCache (if any) for each thread
+   void prepareCellAdd2D (const DgLocation& add2D, DgCellOutput& out,
+               const DgRFBase* outRF, const std::string* labelIn = nullptr,
+               DgDataList* dataList = nullptr,
+               DgVertexCache* vertCache = nullptr) const;
+   void writeCellOutput (DgCellOutput& out, DgDataList* dataList = nullptr);
+
    void resetFiles (void);
 
    // the parameters
@@ -82,6 +118,7 @@ struct SubOpOut : public SubOpBasic {
    char outputDelimiter;
 
    int nDensify;          // number of points-per-edge of densification
+   DgVertexCache vertCache; // boundary points of recently output cells
 
    DgGeoSphRF::DgLonWrapMode lonWrapMode;
                // how to handle outputting cells that straddle the anti-meridian
@@ -106,6 +143,7 @@ struct SubOpOut : public SubOpBasic {
    std::string gdalPointDriver;
    std::string randPtsOutType;
    std::string gdalCollectDriver;
+   unsigned long int gdalTransactionBatchSize;
 
    std::string neighborsOutType;
    std::string childrenOutType;
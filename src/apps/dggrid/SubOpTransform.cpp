@@ -22,7 +22,13 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <dglib/DgBoundedIDGG.h>
 #include <dglib/DgCell.h>
@@ -32,8 +38,10 @@
 #include <dglib/DgInputStream.h>
 #include <dglib/DgOutputStream.h>
 #include <dglib/DgDataField.h>
+#include <dglib/DgGeoSphRF.h>
 #include <dglib/DgInLocTextFile.h>
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 #include "SubOpTransform.h"
 
@@ -93,24 +101,81 @@ SubOpTransform::executeOp (void) {
    dgcout << "Res " << dgg.outputRes() << " " << dgg.gridStats() << std::endl;
    dgcout << "\ntransforming values..." << std::endl;
 
-   while (true) {
+   if (op.mainOp.numThreads > 1 && op.inOp.pointInputFileType == "TEXT") {
+
+      transformThreaded();
+
+   } else if (op.inOp.pInRF == &op.dggOp.deg()) {
+
+      // GEO input points are quantified in batches directly into the dgg,
+      // bypassing the converter network
+
+      const DgGeoSphDegRF& deg = op.dggOp.deg();
+      const size_t batchSize = 4096;
+      std::vector<DgLocationData*> locs;
+      std::vector<long double> lon(batchSize), lat(batchSize);
+      std::vector<DgQ2DICoord> adds(batchSize);
+      DgLocation cell(dgg);
+
+      bool done = false;
+      while (!done) {
+
+         locs.clear();
+         while (locs.size() < batchSize) {
+            DgLocationData* loc = op.inOp.getNextLoc();
+            if (!loc) { // reached EOF on last input file
+               done = true;
+               break;
+            }
+
+            const DgDVec2D& pt = *deg.getAddress(*loc);
+            lon[locs.size()] = pt.x();
+            lat[locs.size()] = pt.y();
+            locs.push_back(loc);
+         }
+
+         {
+            DgProfileScope prof(DgRunProfile::Projection);
+            prof.setCount((long long int) locs.size());
+            dgg.quantifyBatch(&lon[0], &lat[0], locs.size(), &adds[0]);
+         }
+
+         for (size_t k = 0; k < locs.size(); k++) {
+            dgg.forceAddress(&cell, adds[k]);
+            op.outOp.outputCellAdd2D(cell, nullptr, locs[k]->dataList());
+
+#if DGDEBUG
+   dgcout << "TRANSFORM: " << *locs[k] << " -> " << cell << std::endl;
+#endif
+
+            delete locs[k];
+         }
+      }
+
+   } else {
+
+      while (true) {
 
-      DgLocationData* loc = op.inOp.getNextLoc();
-      if (!loc) break; // reached EOF on last input file
+         DgLocationData* loc = op.inOp.getNextLoc();
+         if (!loc) break; // reached EOF on last input file
 #if DGDEBUG
    dgcout << "TRANSFORM BEFORE: " << *loc << std::endl;
 #endif
 
-      //op.outOp.pOutRF->convert(loc);
-      dgg.convert(loc);
+         //op.outOp.pOutRF->convert(loc);
+         {
+            DgProfileScope prof(DgRunProfile::Projection);
+            dgg.convert(loc);
+         }
 
-      op.outOp.outputCellAdd2D(*loc, nullptr, loc->dataList());
+         op.outOp.outputCellAdd2D(*loc, nullptr, loc->dataList());
 
 #if DGDEBUG
    dgcout << "TRANSFORM AFTER: " << *loc << std::endl;
 #endif
 
-      delete loc;
+         delete loc;
+      }
    }
 
    int numFiles = op.inOp.fileNum;
@@ -122,6 +187,208 @@ SubOpTransform::executeOp (void) {
 
 } // int SubOpTransform::executeOp
 
+////////////////////////////////////////////////////////////////////////////////
+// a chunk of consecutive input lines and the corresponding transformed cells;
+// the lines are either copied or are a block of a memory mapped input file
+struct DgTransformChunk {
+
+   DgTransformChunk (void) : blockBegin (nullptr), blockEnd (nullptr) { }
+
+   std::vector<std::string> lines;
+   const char* blockBegin;
+   const char* blockEnd;
+   std::vector<DgLocationData*> locs;
+   std::vector<DgCellOutput*> cells;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+void
+SubOpTransform::transformThreaded (void)
+//
+// Transform the TEXT input using op.mainOp.numThreads worker threads. A
+// reader thread splits the input lines into fixed-size chunks, the workers
+// parse and transform the chunks, and this thread writes the transformed
+// chunks in input order, so the output is identical to the single-threaded
+// version. At most window chunks are in the pipeline at once. Memory mapped
+// input files are split into blocks of lines that the workers parse in place.
+//
+////////////////////////////////////////////////////////////////////////////////
+{
+   const DgIDGGBase& dgg = op.dggOp.dgg();
+   const DgGeoSphDegRF& deg = op.dggOp.deg();
+   const bool geoIn = (op.inOp.pInRF == &deg);
+
+   const size_t chunkSize = 4096;
+   const unsigned long long int blockBytes = 1 << 18;
+   const int nThreads = op.mainOp.numThreads;
+   const unsigned long long int window = 4 * nThreads;
+
+   std::deque< std::pair<unsigned long long int, DgTransformChunk*> > toDo;
+   std::vector<DgTransformChunk*> done(window, nullptr);
+
+   std::mutex mtx;
+   std::condition_variable chunkRead;  // a chunk has been read or input ended
+   std::condition_variable chunkDone;  // a chunk has been transformed
+   std::condition_variable slotFree;   // a chunk has been written
+   unsigned long long int nRead = 0;
+   unsigned long long int nWritten = 0;
+   bool atEOF = false;
+
+   const DgRFBase* outRF = op.outOp.pOutRF;
+
+   auto reader = [&] () {
+      bool more = true;
+      while (more) {
+         DgTransformChunk* chunk = new DgTransformChunk();
+         DgInLocTextFile* mapped = op.inOp.mappedInFile();
+         if (mapped) {
+            if (!mapped->nextBlock(blockBytes, chunk->blockBegin,
+                                   chunk->blockEnd)) {
+               // the workers read the mapped file in place, so all of its
+               // chunks must be written before moving to the next file
+               {
+                  std::unique_lock<std::mutex> lock(mtx);
+                  slotFree.wait(lock, [&] { return nWritten == nRead; });
+               }
+               more = op.inOp.nextInFile();
+            }
+         } else {
+            chunk->lines.reserve(chunkSize);
+            std::string line;
+            while (chunk->lines.size() < chunkSize) {
+               if (!op.inOp.getNextLine(line)) {
+                  more = false;
+                  break;
+               }
+               chunk->lines.push_back(line);
+            }
+         }
+
+         {
+            std::unique_lock<std::mutex> lock(mtx);
+            slotFree.wait(lock, [&] { return nRead < nWritten + window; });
+            if (chunk->lines.empty() && !chunk->blockBegin)
+               delete chunk;
+            else
+               toDo.push_back(std::make_pair(nRead++, chunk));
+
+            atEOF = !more;
+         }
+         chunkRead.notify_one();
+      }
+
+      // wake any waiting workers and the writer
+      chunkRead.notify_all();
+      chunkDone.notify_all();
+   };
+
+   auto worker = [&] () {
+      DgLocation cell(dgg);
+      while (true) {
+         unsigned long long int seq;
+         DgTransformChunk* chunk;
+         {
+            std::unique_lock<std::mutex> lock(mtx);
+            chunkRead.wait(lock, [&] { return !toDo.empty() || atEOF; });
+            if (toDo.empty())
+               return;
+
+            seq = toDo.front().first;
+            chunk = toDo.front().second;
+            toDo.pop_front();
+         }
+
+         const size_t n = chunk->lines.size();
+         chunk->locs.reserve((n) ? n : chunkSize);
+         chunk->cells.reserve((n) ? n : chunkSize);
+         const char* pos = chunk->blockBegin;
+         for (size_t i = 0; ; i++) {
+            DgLocationData* loc = nullptr;
+            if (chunk->blockBegin) {
+               const char* begin;
+               const char* end;
+               if (!DgInLocTextFile::nextLine(pos, chunk->blockEnd, begin, end))
+                  break;
+
+               loc = op.primarySubOp->inStrToPointLoc(begin, end);
+            } else {
+               if (i >= n)
+                  break;
+
+               loc = op.primarySubOp->inStrToPointLoc(chunk->lines[i]);
+            }
+
+            DgCellOutput* out = new DgCellOutput();
+            if (geoIn) {
+               const DgDVec2D& pt = *deg.getAddress(*loc);
+               {
+                  DgProfileScope prof(DgRunProfile::Projection);
+                  dgg.forceAddress(&cell,
+                           dgg.quantify(DgGeoCoord(pt.x(), pt.y(), false)));
+               }
+               op.outOp.prepareCellAdd2D(cell, *out, outRF, nullptr,
+                                         loc->dataList());
+            } else {
+               {
+                  DgProfileScope prof(DgRunProfile::Projection);
+                  dgg.convert(loc);
+               }
+               op.outOp.prepareCellAdd2D(*loc, *out, outRF, nullptr,
+                                         loc->dataList());
+            }
+
+            chunk->locs.push_back(loc);
+            chunk->cells.push_back(out);
+         }
+         std::vector<std::string>().swap(chunk->lines);
+
+         {
+            std::lock_guard<std::mutex> lock(mtx);
+            done[seq % window] = chunk;
+         }
+         chunkDone.notify_one();
+      }
+   };
+
+   std::thread readerThread(reader);
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; t++)
+      threads.push_back(std::thread(worker));
+
+   // write the chunks in input order
+   while (true) {
+      DgTransformChunk* chunk;
+      {
+         std::unique_lock<std::mutex> lock(mtx);
+         chunkDone.wait(lock, [&] {
+               return done[nWritten % window] || (atEOF && nWritten == nRead); });
+         chunk = done[nWritten % window];
+         if (!chunk)
+            break;
+
+         done[nWritten % window] = nullptr;
+      }
+
+      for (size_t i = 0; i < chunk->cells.size(); i++) {
+         op.outOp.writeCellOutput(*chunk->cells[i], chunk->locs[i]->dataList());
+         delete chunk->cells[i];
+         delete chunk->locs[i];
+      }
+      delete chunk;
+
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         nWritten++;
+      }
+      slotFree.notify_all();
+   }
+
+   readerThread.join();
+   for (unsigned long i = 0; i < threads.size(); i++)
+      threads[i].join();
+
+} // void SubOpTransform::transformThreaded
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -42,6 +42,9 @@ struct SubOpTransform : public SubOpBasicMulti {
    virtual int cleanupOp (void);
    virtual int executeOp (void);
 
+   // transform TEXT input using op.mainOp.numThreads worker threads
+   void transformThreaded (void);
+
    // the parameters
 
 };
@@ -27,6 +27,7 @@
 #include <dglib/DgConstants.h>
 #include <dglib/DgBase.h>
 
+#include "DgRunProfile.h"
 #include "OpBasic.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +159,30 @@ int main (int argc, char* argv[])
    // do the operation
    theOperation.execute();
 
+   dgcout << "\n** startup: "
+          << dgg::util::to_string(theOperation.startupSecs, "%.6Lf")
+          << " seconds (grid system construction: "
+          << dgg::util::to_string(theOperation.dggOp.dggsSecs, "%.6Lf")
+          << " seconds)" << std::endl;
+   dgcout << "** total run time: "
+          << dgg::util::to_string(theOperation.secondsSinceStart(), "%.6Lf")
+          << " seconds" << std::endl;
+
+   if (DgRunProfile::enabled()) {
+      DgRunProfile::DgRunTotals totals;
+      totals.operation = theOperation.mainOp.operation;
+      totals.wallSecs = theOperation.secondsSinceStart();
+      totals.startupSecs = theOperation.startupSecs;
+      totals.nCellsTested = theOperation.outOp.nCellsTested;
+      totals.nCellsAccepted = theOperation.outOp.nCellsAccepted;
+
+      const std::string& profFile = theOperation.mainOp.profileFileName;
+      if (DgRunProfile::writeReport(profFile, totals))
+         dgcout << "** run profile written to " << profFile << std::endl;
+      else
+         report("unable to write run profile " + profFile, DgBase::Warning);
+   }
+
    // grab the value before the op is cleaned
    bool pauseBeforeExit = theOperation.mainOp.pauseBeforeExit;
 
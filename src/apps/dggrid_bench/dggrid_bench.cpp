@@ -0,0 +1,1035 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// dggrid_bench.cpp: microbenchmarks of dglib operations on synthetic inputs
+//                   and the example input files
+//
+//    usage: dggrid_bench [-n numPoints] [-e examplesDir] [-j jsonOutFile]
+//                        [-b baselineJsonFile] [-t tolerance]
+//                        [-T numThreads] [-p maxRes] [-d dggridExe]
+//                        [numPoints]
+//
+//    Results are printed as ops/sec and optionally written as JSON. If a
+//    baseline JSON file (from a previous -j run) is given, each result is
+//    compared against it and the exit status is 1 if any operation is
+//    slower than the baseline by more than the tolerance (default 0.10).
+//
+//    The "lonlat Clipper" and "quantify+seqnum hash" operations are proxies
+//    built only from dglib and Clipper calls. The first intersects cell
+//    boundaries with the clip region in lon/lat rather than in each quad's
+//    gnomonic plane, and it skips the clip raster and cell templates that
+//    dggrid's clipping uses. The second accumulates values in a hash map
+//    rather than in dggrid's binning tables. Neither measures dggrid's own
+//    clipping or point binning throughput; use -d for those.
+//
+//    With -d the dggrid executable dggridExe is run with profile_output_file
+//    on the aigenerate example at resolution 11 and on the binvals example
+//    with the benchmark points added to its input, writing its files to the
+//    current directory. The count and wall time of each profiled phase
+//    (best of 3 runs) are reported, written to the JSON file, and compared
+//    against the baseline like the other results. The exit status is 1 if
+//    any dggrid run fails.
+//
+//    With -T each grid system is also frozen and shared by numThreads
+//    threads converting the points at once; the exit status is 1 if any
+//    thread's results differ from those of a single-threaded run.
+//
+//    With -p the cell assignments of the double precision (FAST) projection
+//    kernels are compared against the long double (EXACT) ones for each ISEA
+//    grid at resolutions 0 through maxRes, reporting the number of points
+//    assigned to different cells, how far apart those cells are, and the
+//    errors in meters of the fast inverse projection and of the inverse
+//    projection using the interpolated azimuth (INTERPOLATED). The exit
+//    status is 1 if either inverse error exceeds its documented bound (1
+//    millimeter for FAST, 1e-7 meters for INTERPOLATED).
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+#include <dglib/DgBoundedIDGG.h>
+#include <dglib/DgHierNdxIntRF.h>
+#include <dglib/DgHierNdxSystemRFSBase.h>
+#include <dglib/DgIDGGBase.h>
+#include <dglib/DgIDGGSBase.h>
+#include <dglib/DgInShapefile.h>
+#include <dglib/DgPolygon.h>
+#include <dglib/DgProjTriRF.h>
+
+#include "clipper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+struct BenchGrid {
+
+   string name;
+   string projType;
+   unsigned int aperture;
+   DgGridTopology topo;
+   DgGridMetric metric;
+   int res;
+   DgHierNdxSysType hierNdxSysType;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+struct BenchResult {
+
+   string grid;
+   string op;
+   size_t n;
+   double secs;
+
+   double opsPerSec (void) const { return (secs > 0.0) ? n / secs : 0.0; }
+};
+
+static vector<BenchResult> results;
+
+////////////////////////////////////////////////////////////////////////////////
+static double
+secondsSince (const chrono::steady_clock::time_point& start)
+{
+   return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void
+report (const string& grid, const string& op, size_t n, double secs)
+{
+   BenchResult r = { grid, op, n, secs };
+   results.push_back(r);
+
+   cout << left << setw(12) << grid << setw(36) << op << right
+        << setw(14) << fixed << setprecision(0) << r.opsPerSec()
+        << " ops/sec" << endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// run op(i) for i in [0, n) and report the throughput
+static void
+timeOp (const string& grid, const string& op, size_t n,
+        const function<void (size_t)>& f)
+{
+   auto start = chrono::steady_clock::now();
+   for (size_t i = 0; i < n; i++)
+      f(i);
+   report(grid, op, n, secondsSince(start));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static string
+hierNdxName (DgHierNdxSysType type)
+{
+   switch (type) {
+      case dgg::addtype::Z3: return "Z3";
+      case dgg::addtype::Z7: return "Z7";
+      case dgg::addtype::ZOrder: return "ZORDER";
+      default: return "";
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// clip polygons in clipper integer coordinates; lon/lat degrees scaled by
+// clipScale (the clipping is done in the plane, as dggrid does in the
+// gnomonic plane of each quad)
+static const double clipScale = 1.0E6;
+
+static ClipperLib::Path
+toClipperPath (const DgGeoSphRF& geoRF, const DgPolygon& poly)
+{
+   ClipperLib::Path path(poly.size());
+   for (int i = 0; i < poly.size(); i++) {
+      const DgGeoCoord& g = *geoRF.getAddress(poly[i]);
+      path[i] = ClipperLib::IntPoint(
+                  (ClipperLib::cInt) (g.lonDegs() * clipScale),
+                  (ClipperLib::cInt) (g.latDegs() * clipScale));
+   }
+
+   return path;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the clipping region: the polygons of the aigenerate example shapefile if
+// they can be found, otherwise a synthetic polygon of similar size
+static void
+loadClipRegion (const DgGeoSphRF& geoRF, const string& examplesDir,
+                ClipperLib::Paths& region, string& regionName)
+{
+   region.clear();
+   if (!examplesDir.empty()) {
+      string fileName = examplesDir + "/aigenerate/inputfiles/orbuff";
+      ifstream test((fileName + ".shp").c_str());
+      if (test.good()) {
+         test.close();
+         DgInShapefile file(geoRF, &fileName);
+         while (true) {
+            DgPolygon poly;
+            file >> poly;
+            if (file.isEOF()) break;
+            region.push_back(toClipperPath(geoRF, poly));
+         }
+
+         regionName = "orbuff";
+      }
+   }
+
+   if (region.empty()) {
+      // a 32-gon centered on Oregon
+      ClipperLib::Path path;
+      for (int i = 0; i < 32; i++) {
+         double a = 2.0 * M_PI * i / 32.0;
+         path.push_back(ClipperLib::IntPoint(
+               (ClipperLib::cInt) ((-120.5 + 4.0 * cos(a)) * clipScale),
+               (ClipperLib::cInt) ((44.0 + 2.5 * sin(a)) * clipScale)));
+      }
+      region.push_back(path);
+      regionName = "synthetic";
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// points and values from the binning example input files, if found
+static void
+loadBinPoints (const string& examplesDir, vector<DgGeoCoord>& pts,
+               vector<double>& vals)
+{
+   if (examplesDir.empty()) return;
+
+   const char* files[] = { "20k.txt", "50k.txt", "100k.txt", "200k.txt" };
+   for (const auto f: files) {
+      ifstream in((examplesDir + "/binvals/inputfiles/" + f).c_str());
+      string line;
+      while (getline(in, line)) {
+         istringstream is(line);
+         long double lon, lat;
+         double val;
+         if (is >> lon >> lat >> val) {
+            pts.push_back(DgGeoCoord(lon, lat, false));
+            vals.push_back(val);
+         }
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void
+benchGrid (const BenchGrid& bg, const vector<DgGeoCoord>& pts,
+           const vector<double>& vals, const string& examplesDir)
+{
+   DgRFNetwork net;
+   const DgGeoSphRF& geoRF = *(DgGeoSphRF::makeRF(net, "GS0"));
+   DgGeoCoord vert0(11.25L, 58.28252559L, false);
+
+   // one extra resolution for the children
+   const DgIDGGSBase& dggs = *(DgIDGGSBase::makeRF(net, geoRF, vert0, 0.0L,
+            bg.aperture, bg.res + 2, bg.topo, bg.metric, "IDGGS", bg.projType,
+            false, DgApSeq::defaultApSeq, false, 0, false, bg.hierNdxSysType));
+   const DgIDGGBase& dgg = dggs.idggBase(bg.res);
+
+   const size_t n = pts.size();
+   vector<DgQ2DICoord> netAdds(n);
+   vector<DgQ2DICoord> adds(n);
+
+   // geo -> Q2DI through the RF network
+   timeOp(bg.name, "geo->Q2DI network", n, [&] (size_t i) {
+      DgLocation* loc = geoRF.makeLocation(pts[i]);
+      dgg.convert(loc);
+      netAdds[i] = *dgg.getAddress(*loc);
+      delete loc;
+   });
+
+   // geo -> Q2DI using the value-typed path
+   timeOp(bg.name, "geo->Q2DI quantify", n, [&] (size_t i) {
+      adds[i] = dgg.quantify(pts[i]);
+   });
+
+   // geo -> Q2DI in blocks of points
+   vector<DgQ2DICoord> batchAdds(n);
+   {
+      const size_t blockSize = 1000;
+      auto start = chrono::steady_clock::now();
+      for (size_t i = 0; i < n; i += blockSize)
+         dgg.quantifyBatch(&pts[i], min(blockSize, n - i), &batchAdds[i]);
+      report(bg.name, "geo->Q2DI quantifyBatch", n, secondsSince(start));
+   }
+
+   size_t nDiff = 0;
+   for (size_t i = 0; i < n; i++)
+      if (adds[i] != netAdds[i] || batchAdds[i] != adds[i]) nDiff++;
+
+   // Q2DI -> geo through the RF network
+   vector<DgGeoCoord> netCtrs(n);
+   timeOp(bg.name, "Q2DI->geo network", n, [&] (size_t i) {
+      DgLocation* loc = dgg.makeLocation(adds[i]);
+      geoRF.convert(loc);
+      netCtrs[i] = *geoRF.getAddress(*loc);
+      delete loc;
+   });
+
+   // Q2DI -> geo using the value-typed path
+   vector<DgGeoCoord> ctrs(n);
+   timeOp(bg.name, "Q2DI->geo invQuantify", n, [&] (size_t i) {
+      ctrs[i] = dgg.invQuantify(adds[i]);
+   });
+
+   for (size_t i = 0; i < n; i++)
+      if (ctrs[i] != netCtrs[i]) nDiff++;
+
+   // cell boundaries
+   DgPolygon verts(dgg);
+   timeOp(bg.name, "setAddVertices", n, [&] (size_t i) {
+      dgg.setAddVertices(adds[i], verts);
+   });
+
+   // sequence numbers
+   const DgBoundedIDGG& bnd = dgg.bndRF();
+   vector<unsigned long long int> seqNums(n);
+   timeOp(bg.name, "Q2DI->seqnum", n, [&] (size_t i) {
+      seqNums[i] = bnd.seqNumAddress(adds[i]);
+   });
+
+   timeOp(bg.name, "seqnum->Q2DI", n, [&] (size_t i) {
+      if (bnd.addFromSeqNum(seqNums[i]) != adds[i]) nDiff++;
+   });
+
+   // hierarchical indexes
+   const DgHierNdxSystemRFSBase* hierNdx = dggs.hierNdxSystem();
+   if (hierNdx && hierNdx->hasIntCodec()) {
+      const string sysName = hierNdxName(bg.hierNdxSysType);
+      vector<DgHierNdxIntCoord> ndxs(n);
+      timeOp(bg.name, sysName + " encode", n, [&] (size_t i) {
+         ndxs[i] = hierNdx->quantifyInt(adds[i], bg.res);
+      });
+
+      timeOp(bg.name, sysName + " decode", n, [&] (size_t i) {
+         if (hierNdx->invQuantifyInt(ndxs[i], bg.res) != adds[i]) nDiff++;
+      });
+   }
+
+   // neighbors
+   DgLocVector nbrs(dgg);
+   timeOp(bg.name, "setAddNeighbors", n, [&] (size_t i) {
+      dgg.setAddNeighbors(adds[i], nbrs);
+   });
+
+   // children
+   DgLocVector chld(dggs);
+   timeOp(bg.name, "setAllChildren", n, [&] (size_t i) {
+      dggs.setAllChildren(DgResAdd<DgQ2DICoord>(adds[i], bg.res), chld);
+   });
+
+   // clip proxy: intersect the lon/lat boundaries of the cells containing
+   // points in the clip region bounding box with the clip region; this is
+   // not dggrid's clipping, which works in the gnomonic plane of each quad
+   // and avoids most intersections with its clip raster
+   ClipperLib::Paths region;
+   string regionName;
+   loadClipRegion(geoRF, examplesDir, region, regionName);
+
+   ClipperLib::IntRect bbox;
+   {
+      ClipperLib::Clipper c;
+      c.AddPaths(region, ClipperLib::ptClip, true);
+      bbox = c.GetBounds();
+   }
+
+   mt19937 gen(5678);
+   uniform_real_distribution<long double> lonDist(bbox.left / clipScale,
+                                                  bbox.right / clipScale);
+   uniform_real_distribution<long double> latDist(bbox.top / clipScale,
+                                                  bbox.bottom / clipScale);
+   const size_t nClip = n / 10 + 1;
+   vector<ClipperLib::Path> cellPaths(nClip);
+   for (size_t i = 0; i < nClip; i++) {
+      DgGeoCoord p(lonDist(gen), latDist(gen), false);
+      dgg.setAddVertices(dgg.quantify(p), verts);
+      geoRF.convert(verts);
+      cellPaths[i] = toClipperPath(geoRF, verts);
+   }
+
+   size_t nAccepted = 0;
+   ClipperLib::Clipper clipper;
+   ClipperLib::Paths solution;
+   timeOp(bg.name, "lonlat Clipper " + regionName, nClip, [&] (size_t i) {
+      clipper.Clear();
+      clipper.AddPath(cellPaths[i], ClipperLib::ptSubject, true);
+      clipper.AddPaths(region, ClipperLib::ptClip, true);
+      clipper.Execute(ClipperLib::ctIntersection, solution,
+                      ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+      if (!solution.empty()) nAccepted++;
+   });
+
+   // binning proxy: quantify each point and accumulate its value by sequence
+   // number in a hash map; this is not dggrid's binning code
+   unordered_map<unsigned long long int, pair<double, unsigned long int> > bins;
+   timeOp(bg.name, "quantify+seqnum hash", n, [&] (size_t i) {
+      auto& b = bins[bnd.seqNumAddress(dgg.quantify(pts[i]))];
+      b.first += vals[i];
+      b.second++;
+   });
+
+   // the binning example points, repeated
+   vector<DgGeoCoord> exPts;
+   vector<double> exVals;
+   loadBinPoints(examplesDir, exPts, exVals);
+   if (!exPts.empty()) {
+      bins.clear();
+      timeOp(bg.name, "quantify+seqnum hash (examples)", n, [&] (size_t i) {
+         size_t j = i % exPts.size();
+         auto& b = bins[bnd.seqNumAddress(dgg.quantify(exPts[j]))];
+         b.first += exVals[j];
+         b.second++;
+      });
+   }
+
+   if (nDiff)
+      cout << "*** " << bg.name << ": " << nDiff
+           << " value-typed conversions differ from the network" << endl;
+
+   if (!nAccepted)
+      cout << "*** " << bg.name << ": no cells accepted by the clip region"
+           << endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the conversions of one point performed by the hammer test
+struct HammerResult {
+
+   DgQ2DICoord add;
+   unsigned long long int seqNum;
+   DgGeoCoord ctr;
+   string text; // projTri location, cell boundary and children
+
+   bool operator== (const HammerResult& r) const
+      { return add == r.add && seqNum == r.seqNum && ctr == r.ctr &&
+               text == r.text; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// convert every point through one frozen grid system from numThreads threads
+// at once, checking the results against a single-threaded run; returns the
+// number of mismatched results
+static size_t
+hammerGrid (const BenchGrid& bg, const vector<DgGeoCoord>& pts,
+            int numThreads)
+{
+   DgRFNetwork net;
+   const DgGeoSphRF& geoRF = *(DgGeoSphRF::makeRF(net, "GS0"));
+   DgGeoCoord vert0(11.25L, 58.28252559L, false);
+
+   const DgIDGGSBase& dggs = *(DgIDGGSBase::makeRF(net, geoRF, vert0, 0.0L,
+            bg.aperture, bg.res + 2, bg.topo, bg.metric, "IDGGS", bg.projType,
+            false, DgApSeq::defaultApSeq, false, 0, false, bg.hierNdxSysType));
+
+   auto start = chrono::steady_clock::now();
+   dggs.freeze();
+   const double freezeSecs = secondsSince(start);
+   cout << left << setw(10) << bg.name << "froze " << net.size()
+        << " frames (" << net.numConverters() << " converters) in "
+        << setprecision(3) << freezeSecs << " secs" << endl;
+
+   // spread the points over all but the last resolution (which has no
+   // children)
+   const int nRes = bg.res + 1;
+   auto convertPt = [&] (size_t i, HammerResult& r) {
+      const int res = (int) (i % nRes);
+      const DgIDGGBase& dgg = dggs.idggBase(res);
+
+      DgLocation* loc = geoRF.makeLocation(pts[i]);
+      dgg.convert(loc);
+      r.add = *dgg.getAddress(*loc);
+      r.seqNum = dgg.bndRF().seqNum(*loc);
+
+      ostringstream os;
+      DgLocation tri(*loc);
+      dgg.projTriRF().convert(&tri);
+      os << tri;
+
+      DgPolygon verts(dgg);
+      dgg.setVertices(*loc, verts, 0);
+      os << verts;
+
+      DgLocVector chld(dggs);
+      dggs.setAllChildren(DgResAdd<DgQ2DICoord>(r.add, res), chld);
+      os << chld;
+      r.text = os.str();
+
+      geoRF.convert(loc);
+      r.ctr = *geoRF.getAddress(*loc);
+      delete loc;
+   };
+
+   const size_t n = pts.size();
+   vector<HammerResult> expected(n);
+   timeOp(bg.name, "frozen 1 thread", n, [&] (size_t i) {
+      convertPt(i, expected[i]);
+   });
+
+   // each thread converts every point, starting at a different offset
+   atomic<size_t> nDiff(0);
+   start = chrono::steady_clock::now();
+   vector<thread> threads;
+   for (int t = 0; t < numThreads; t++) {
+      threads.push_back(thread([&, t] () {
+         HammerResult r;
+         for (size_t k = 0; k < n; k++) {
+            const size_t i = (k + t * n / numThreads) % n;
+            convertPt(i, r);
+            if (!(r == expected[i]))
+               nDiff++;
+         }
+      }));
+   }
+
+   for (auto& th: threads)
+      th.join();
+
+   report(bg.name, "frozen " + to_string(numThreads) + " threads",
+          n * numThreads, secondsSince(start));
+
+   if (nDiff)
+      cout << bg.name << ": " << nDiff << " results differ from the "
+           << "single-threaded run" << endl;
+
+   return nDiff;
+
+} // size_t hammerGrid
+
+////////////////////////////////////////////////////////////////////////////////
+// the chord distance between two points on the unit sphere; unlike gcDist it
+// resolves separations well below a millimeter on the earth
+static long double
+chordDist (const DgGeoCoord& p1, const DgGeoCoord& p2)
+{
+   const long double dx = cosl(p1.lat()) * cosl(p1.lon()) -
+                          cosl(p2.lat()) * cosl(p2.lon());
+   const long double dy = cosl(p1.lat()) * sinl(p1.lon()) -
+                          cosl(p2.lat()) * sinl(p2.lon());
+   const long double dz = sinl(p1.lat()) - sinl(p2.lat());
+
+   return sqrtl(dx * dx + dy * dy + dz * dz);
+
+} // long double chordDist
+
+////////////////////////////////////////////////////////////////////////////////
+// compare the cells the points are assigned to by the double precision
+// (FAST) projection kernels against the long double (EXACT) ones at each
+// resolution up to maxRes, and the fast and interpolated inverse
+// projections against the exact iterative one; returns the number of
+// resolutions at which an inverse error exceeds its documented bound
+static size_t
+validatePrecision (const BenchGrid& bg, const vector<DgGeoCoord>& pts,
+                   int maxRes)
+{
+   // the bounds documented for precision_mode FAST and for
+   // isea_inverse_method INTERPOLATED
+   const long double maxFastErrM = 1.0e-3L;
+   const long double maxInterpErrM = 1.0e-7L;
+
+   DgRFNetwork net;
+   const DgGeoSphRF& geoRF = *(DgGeoSphRF::makeRF(net, "GS0"));
+   DgGeoCoord vert0(11.25L, 58.28252559L, false);
+
+   // Q2DI coordinates of aperture 7 grids overflow beyond resolution 20
+   if (bg.aperture == 7)
+      maxRes = min(maxRes, 20);
+
+   const DgIDGGSBase& exact = *(DgIDGGSBase::makeRF(net, geoRF, vert0, 0.0L,
+            bg.aperture, maxRes + 1, bg.topo, bg.metric, "IDGGS", bg.projType));
+   const DgIDGGSBase& fast = *(DgIDGGSBase::makeRF(net, geoRF, vert0, 0.0L,
+            bg.aperture, maxRes + 1, bg.topo, bg.metric, "IDGGSF", bg.projType));
+   fast.sphIcosa().setPrecisionMode(DgSphIcosa::Fast);
+   const DgIDGGSBase& interp = *(DgIDGGSBase::makeRF(net, geoRF, vert0, 0.0L,
+            bg.aperture, maxRes + 1, bg.topo, bg.metric, "IDGGSI", bg.projType));
+   interp.sphIcosa().setInverseMethod(DgSphIcosa::Interpolated);
+
+   const long double radiusM = geoRF.earthRadiusKM() * 1000.0L;
+   const size_t n = pts.size();
+
+   cout << left << setw(10) << bg.name << setw(6) << "res" << right
+        << setw(10) << "differ" << setw(14) << "fraction"
+        << setw(16) << "max sep (cells)" << setw(18) << "max ctr err (m)"
+        << setw(18) << "max interp (m)" << endl;
+
+   size_t nFail = 0;
+   for (int res = 0; res <= maxRes; res++) {
+      const DgIDGGBase& exactDgg = exact.idggBase(res);
+      const DgIDGGBase& fastDgg = fast.idggBase(res);
+      const DgIDGGBase& interpDgg = interp.idggBase(res);
+
+      // the separation of the differing cells, as a multiple of the
+      // intercell distance, and the errors of the fast and interpolated
+      // inverses at the exact cell center
+      size_t nDiff = 0;
+      long double maxSep = 0.0L;
+      long double maxCtrErr = 0.0L;
+      long double maxInterpErr = 0.0L;
+      for (size_t i = 0; i < n; i++) {
+         const DgQ2DICoord add = exactDgg.quantify(pts[i]);
+         const DgQ2DICoord fastAdd = fastDgg.quantify(pts[i]);
+         const DgGeoCoord ctr = exactDgg.invQuantify(add);
+
+         if (fastAdd != add) {
+            nDiff++;
+            maxSep = max(maxSep, DgGeoCoord::gcDist(ctr,
+                                       exactDgg.invQuantify(fastAdd)));
+         }
+
+         maxCtrErr = max(maxCtrErr,
+                         chordDist(ctr, fastDgg.invQuantify(add)));
+         maxInterpErr = max(maxInterpErr,
+                            chordDist(ctr, interpDgg.invQuantify(add)));
+      }
+
+      maxSep *= geoRF.earthRadiusKM() / exactDgg.gridStats().cellDistKM();
+
+      cout << left << setw(10) << bg.name << setw(6) << res << right
+           << setw(10) << nDiff << setw(14) << scientific << setprecision(3)
+           << (double) nDiff / n << setw(16) << fixed << setprecision(3)
+           << (double) maxSep << setw(18) << scientific << setprecision(3)
+           << (double) (maxCtrErr * radiusM) << setw(18)
+           << (double) (maxInterpErr * radiusM) << fixed << endl;
+
+      if (maxCtrErr * radiusM > maxFastErrM) {
+         nFail++;
+         cout << bg.name << " res " << res << ": fast inverse error exceeds "
+              << scientific << (double) maxFastErrM << fixed << " m" << endl;
+      }
+
+      if (maxInterpErr * radiusM > maxInterpErrM) {
+         nFail++;
+         cout << bg.name << " res " << res << ": interpolated inverse error "
+              << "exceeds " << scientific << (double) maxInterpErrM << fixed
+              << " m" << endl;
+      }
+   }
+
+   const DgIDGGBase& exactDgg = exact.idggBase(maxRes);
+   const DgIDGGBase& fastDgg = fast.idggBase(maxRes);
+   vector<DgQ2DICoord> adds(n);
+   timeOp(bg.name, "geo->Q2DI quantify exact", n, [&] (size_t i) {
+      adds[i] = exactDgg.quantify(pts[i]);
+   });
+   timeOp(bg.name, "geo->Q2DI quantify fast", n, [&] (size_t i) {
+      fastDgg.quantify(pts[i]);
+   });
+   timeOp(bg.name, "Q2DI->geo invQuantify exact", n, [&] (size_t i) {
+      exactDgg.invQuantify(adds[i]);
+   });
+   timeOp(bg.name, "Q2DI->geo invQuantify fast", n, [&] (size_t i) {
+      fastDgg.invQuantify(adds[i]);
+   });
+
+   const DgIDGGBase& interpDgg = interp.idggBase(maxRes);
+   timeOp(bg.name, "Q2DI->geo invQuantify interpolated", n, [&] (size_t i) {
+      interpDgg.invQuantify(adds[i]);
+   });
+
+   // cell boundaries are dominated by the inverse projection
+   DgPolygon verts(exactDgg);
+   timeOp(bg.name, "setAddVertices exact", n, [&] (size_t i) {
+      exactDgg.setAddVertices(adds[i], verts);
+   });
+   DgPolygon interpVerts(interpDgg);
+   timeOp(bg.name, "setAddVertices interpolated", n, [&] (size_t i) {
+      interpDgg.setAddVertices(adds[i], interpVerts);
+   });
+
+   return nFail;
+
+} // size_t validatePrecision
+
+////////////////////////////////////////////////////////////////////////////////
+static string
+jsonEscape (const string& s)
+{
+   string out;
+   for (const auto c: s) {
+      if (c == '"' || c == '\\') out += '\\';
+      out += c;
+   }
+
+   return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void
+writeJson (const string& fileName, size_t numPts)
+{
+   ofstream out(fileName.c_str());
+   if (!out.good()) {
+      cerr << "dggrid_bench: unable to open " << fileName << endl;
+      exit(1);
+   }
+
+   // one result per line, which is all readBaseline needs
+   out << "{\n  \"dggrid_version\": \"" << DGGRID_VERSION << "\",\n"
+       << "  \"num_points\": " << numPts << ",\n  \"results\": [\n";
+   for (size_t i = 0; i < results.size(); i++) {
+      const BenchResult& r = results[i];
+      out << "    {\"grid\": \"" << jsonEscape(r.grid) << "\", \"op\": \""
+          << jsonEscape(r.op) << "\", \"n\": " << r.n << ", \"seconds\": "
+          << setprecision(6) << fixed << r.secs << ", \"ops_per_sec\": "
+          << setprecision(0) << r.opsPerSec() << "}"
+          << ((i + 1 < results.size()) ? "," : "") << "\n";
+   }
+   out << "  ]\n}\n";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// extract the string value of "key" from a line written by writeJson
+static bool
+jsonStringField (const string& line, const string& key, string& val)
+{
+   string pat = "\"" + key + "\": \"";
+   size_t p = line.find(pat);
+   if (p == string::npos) return false;
+
+   val.clear();
+   for (p += pat.size(); p < line.size() && line[p] != '"'; p++) {
+      if (line[p] == '\\' && p + 1 < line.size()) p++;
+      val += line[p];
+   }
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static bool
+jsonNumberField (const string& line, const string& key, double& val)
+{
+   string pat = "\"" + key + "\": ";
+   size_t p = line.find(pat);
+   if (p == string::npos) return false;
+
+   val = strtod(line.c_str() + p + pat.size(), NULL);
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// write a copy of an example metafile with the parameters in overrides
+// replaced (or added) and profiling turned on
+static bool
+writeBenchMeta (const string& exampleMeta, const string& benchMeta,
+                map<string, string> overrides)
+{
+   ifstream in(exampleMeta.c_str());
+   ofstream out(benchMeta.c_str());
+   if (!in.good() || !out.good()) return false;
+
+   string line;
+   while (getline(in, line)) {
+      istringstream is(line);
+      string key;
+      is >> key;
+      auto it = overrides.find(key);
+      if (it == overrides.end())
+         out << line << "\n";
+      else {
+         out << key << " " << it->second << "\n";
+         overrides.erase(it);
+      }
+   }
+
+   for (const auto& o: overrides)
+      out << o.first << " " << o.second << "\n";
+
+   return out.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// run dggrid on benchMeta numReps times and report the count and the best
+// wall time of each phase in the run profiles; returns false on failure
+static bool
+profileDggrid (const string& dggridExe, const string& name,
+               const string& benchMeta, const string& profileFile,
+               int numReps)
+{
+   map<string, pair<double, double> > best; // phase -> (count, wall seconds)
+   for (int rep = 0; rep < numReps; rep++) {
+      remove(profileFile.c_str());
+      string cmd = "\"" + dggridExe + "\" " + benchMeta + " > " +
+                   "dggrid_bench_" + name + ".log";
+      if (system(cmd.c_str()) != 0) {
+         cerr << "dggrid_bench: " << cmd << " failed" << endl;
+         return false;
+      }
+
+      ifstream in(profileFile.c_str());
+      if (!in.good()) {
+         cerr << "dggrid_bench: no run profile " << profileFile << endl;
+         return false;
+      }
+
+      // the phase lines are the ones with a count
+      string line;
+      while (getline(in, line)) {
+         double count, secs;
+         size_t p0 = line.find('"');
+         size_t p1 = line.find('"', p0 + 1);
+         if (p1 == string::npos ||
+             !jsonNumberField(line, "count", count) ||
+             !jsonNumberField(line, "wall_seconds", secs))
+            continue;
+
+         string phase = line.substr(p0 + 1, p1 - p0 - 1);
+         auto it = best.find(phase);
+         if (it == best.end() || secs < it->second.second)
+            best[phase] = make_pair(count, secs);
+      }
+   }
+
+   for (const auto& b: best)
+      report(name, "dggrid " + b.first, (size_t) b.second.first,
+             b.second.second);
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// run dggrid with profile_output_file on the aigenerate and binvals examples,
+// scaled up so that the phase times are long enough to compare: aigenerate at
+// a finer resolution, and binvals with the benchmark points added to its
+// input; returns the number of failed runs
+static int
+profileExamples (const string& dggridExe, const string& examplesDir,
+                 const vector<DgGeoCoord>& pts, const vector<double>& vals)
+{
+   const int numReps = 3;
+   int nFail = 0;
+
+   cout << "\ndggrid run profiles (best of " << numReps << " runs):" << endl;
+
+   map<string, string> aigen;
+   aigen["dggs_res_spec"] = "11";
+   aigen["clip_region_files"] = examplesDir + "/aigenerate/inputfiles/orbuff.shp";
+   aigen["cell_output_file_name"] = "dggrid_bench_aigenerate_cells";
+   aigen["point_output_file_name"] = "dggrid_bench_aigenerate_pts";
+   aigen["profile_output_file"] = "dggrid_bench_aigenerate_profile.json";
+   if (!writeBenchMeta(examplesDir + "/aigenerate/aigenerate.meta",
+                       "dggrid_bench_aigenerate.meta", aigen) ||
+       !profileDggrid(dggridExe, "aigenerate", "dggrid_bench_aigenerate.meta",
+                      aigen["profile_output_file"], numReps))
+      nFail++;
+
+   const string ptsFile = "dggrid_bench_binvals_pts.txt";
+   {
+      ofstream out(ptsFile.c_str());
+      out << setprecision(9) << fixed;
+      for (size_t i = 0; i < pts.size(); i++)
+         out << pts[i].lonDegs() << " " << pts[i].latDegs() << " "
+             << vals[i] << "\n";
+   }
+
+   map<string, string> binvals;
+   string inFiles;
+   const char* files[] = { "20k.txt", "50k.txt", "100k.txt", "200k.txt" };
+   for (const auto f: files)
+      inFiles += examplesDir + "/binvals/inputfiles/" + f + " ";
+   binvals["input_files"] = inFiles + ptsFile;
+   binvals["output_file_name"] = "dggrid_bench_binvals.txt";
+   binvals["profile_output_file"] = "dggrid_bench_binvals_profile.json";
+   if (!writeBenchMeta(examplesDir + "/binvals/binvals.meta",
+                       "dggrid_bench_binvals.meta", binvals) ||
+       !profileDggrid(dggridExe, "binvals", "dggrid_bench_binvals.meta",
+                      binvals["profile_output_file"], numReps))
+      nFail++;
+
+   return nFail;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// returns the number of regressions
+static int
+compareBaseline (const string& fileName, double tolerance)
+{
+   ifstream in(fileName.c_str());
+   if (!in.good()) {
+      cerr << "dggrid_bench: unable to open baseline " << fileName << endl;
+      exit(1);
+   }
+
+   map<pair<string, string>, double> baseline;
+   string line;
+   while (getline(in, line)) {
+      string grid, op;
+      double opsPerSec;
+      if (jsonStringField(line, "grid", grid) &&
+          jsonStringField(line, "op", op) &&
+          jsonNumberField(line, "ops_per_sec", opsPerSec))
+         baseline[make_pair(grid, op)] = opsPerSec;
+   }
+
+   cout << "\ncomparison with baseline " << fileName << " (tolerance "
+        << setprecision(0) << fixed << tolerance * 100.0 << "%):" << endl;
+
+   int nRegress = 0;
+   for (const auto& r: results) {
+      auto it = baseline.find(make_pair(r.grid, r.op));
+      if (it == baseline.end() || it->second <= 0.0) continue;
+
+      double ratio = r.opsPerSec() / it->second;
+      bool regressed = ratio < 1.0 - tolerance;
+      if (regressed) nRegress++;
+
+      cout << left << setw(12) << r.grid << setw(36) << r.op << right
+           << setw(9) << setprecision(2) << fixed << ratio << "x"
+           << (regressed ? "  REGRESSION" : "") << endl;
+   }
+
+   cout << nRegress << " regression" << ((nRegress == 1) ? "" : "s")
+        << endl;
+
+   return nRegress;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main (int argc, char** argv)
+{
+   size_t numPts = 100000;
+   string examplesDir = "examples";
+   string jsonFile;
+   string baselineFile;
+   double tolerance = 0.10;
+   int numThreads = 0;
+   int precMaxRes = -1;
+   string dggridExe;
+
+   for (int i = 1; i < argc; i++) {
+      string arg(argv[i]);
+      bool hasVal = (i + 1 < argc);
+      if (arg == "-n" && hasVal)
+         numPts = strtoul(argv[++i], NULL, 10);
+      else if (arg == "-e" && hasVal)
+         examplesDir = argv[++i];
+      else if (arg == "-j" && hasVal)
+         jsonFile = argv[++i];
+      else if (arg == "-b" && hasVal)
+         baselineFile = argv[++i];
+      else if (arg == "-t" && hasVal)
+         tolerance = strtod(argv[++i], NULL);
+      else if (arg == "-T" && hasVal)
+         numThreads = atoi(argv[++i]);
+      else if (arg == "-p" && hasVal)
+         precMaxRes = atoi(argv[++i]);
+      else if (arg == "-d" && hasVal)
+         dggridExe = argv[++i];
+      else if (arg[0] != '-')
+         numPts = strtoul(argv[i], NULL, 10);
+      else {
+         cerr << "usage: dggrid_bench [-n numPoints] [-e examplesDir] "
+                 "[-j jsonOutFile] [-b baselineJsonFile] [-t tolerance] "
+                 "[-T numThreads] [-p maxRes] [-d dggridExe] [numPoints]"
+              << endl;
+         return 1;
+      }
+   }
+
+   // the example input files are optional
+   if (!ifstream((examplesDir + "/examples.lst").c_str()).good()) {
+      cout << "dggrid_bench: examples directory " << examplesDir
+           << " not found; using synthetic inputs only" << endl;
+      examplesDir.clear();
+   }
+
+   const BenchGrid grids[] = {
+      { "ISEA3H", "ISEA", 3, Hexagon, D6, 12, dgg::addtype::Z3 },
+      { "ISEA4H", "ISEA", 4, Hexagon, D6, 10, dgg::addtype::ZOrder },
+      { "ISEA7H", "ISEA", 7, Hexagon, D6, 7, dgg::addtype::Z7 },
+      { "ISEA4T", "ISEA", 4, Triangle, D3, 10, InvalidHierNdxSysType },
+      { "ISEA4D", "ISEA", 4, Diamond, D4, 10, InvalidHierNdxSysType },
+      { "FULLER4H", "FULLER", 4, Hexagon, D6, 10, InvalidHierNdxSysType }
+   };
+
+   // uniformly distributed points on the sphere with random values
+   mt19937 gen(1234);
+   uniform_real_distribution<long double> lonDist(-M_PI, M_PI);
+   uniform_real_distribution<long double> zDist(-1.0L, 1.0L);
+   uniform_real_distribution<double> valDist(0.0, 1000.0);
+   vector<DgGeoCoord> pts(numPts);
+   vector<double> vals(numPts);
+   for (size_t i = 0; i < numPts; i++) {
+      long double lon = lonDist(gen);
+      pts[i] = DgGeoCoord(lon, asinl(zDist(gen)));
+      vals[i] = valDist(gen);
+   }
+
+   cout << "dggrid_bench: " << numPts << " points per benchmark" << endl;
+   for (const auto& bg: grids)
+      benchGrid(bg, pts, vals, examplesDir);
+
+   size_t nHammerDiff = 0;
+   if (numThreads > 0) {
+      // the per-point conversions are much heavier than the benchmarks
+      vector<DgGeoCoord> hammerPts(pts.begin(),
+                              pts.begin() + min(pts.size(), (size_t) 20000));
+      for (const auto& bg: grids)
+         nHammerDiff += hammerGrid(bg, hammerPts, numThreads);
+   }
+
+   size_t nPrecFail = 0;
+   if (precMaxRes >= 0) {
+      for (const auto& bg: grids) {
+         if (bg.projType == "ISEA")
+            nPrecFail += validatePrecision(bg, pts, precMaxRes);
+      }
+   }
+
+   int nProfileFail = 0;
+   if (!dggridExe.empty()) {
+      if (examplesDir.empty()) {
+         cerr << "dggrid_bench: -d requires the examples directory" << endl;
+         nProfileFail++;
+      } else
+         nProfileFail = profileExamples(dggridExe, examplesDir, pts, vals);
+   }
+
+   if (!jsonFile.empty())
+      writeJson(jsonFile, numPts);
+
+   if (nHammerDiff || nPrecFail || nProfileFail)
+      return 1;
+
+   if (!baselineFile.empty() && compareBaseline(baselineFile, tolerance))
+      return 1;
+
+   return 0;
+
+} // main
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 #ifndef DGCONVERTERBASE_H
 #define DGCONVERTERBASE_H
 
+#include <atomic>
 #include <vector>
 
 #include <dglib/DgLocation.h>
@@ -36,12 +37,14 @@ class DgConverterBase {
    public:
       virtual ~DgConverterBase (void);
 
-      static bool isTraceOn (void) { return isTraceOn_; }
+      // the trace settings are shared by all threads
+      static bool isTraceOn (void)
+                     { return isTraceOn_.load(std::memory_order_relaxed); }
       static bool setTraceOn (bool traceOnIn)
-                     { isTraceOn_ = traceOnIn; return isTraceOn(); }
+                     { isTraceOn_.store(traceOnIn); return isTraceOn(); }
       static void setTraceStream (std::ostream& stream = dgcout)
-                           { traceStream_ = &stream; }
-      static std::ostream& traceStream (void) { return *traceStream_; }
+                           { traceStream_.store(&stream); }
+      static std::ostream& traceStream (void) { return *traceStream_.load(); }
 
       virtual DgLocation* convert (DgLocation* loc) const; // convert in place
 
@@ -65,8 +68,8 @@ class DgConverterBase {
       virtual DgAddressBase* createConvertedAddress
                               (const DgAddressBase& addIn) const = 0;
 
-      static bool isTraceOn_;
-      static std::ostream* traceStream_;
+      static std::atomic<bool> isTraceOn_;
+      static std::atomic<std::ostream*> traceStream_;
 
       DgRFBase* fromFrame_;
       DgRFBase* toFrame_;
@@ -59,7 +59,7 @@ template<class A, class B, class DB> class DgDiscRFS
 
       virtual std::string add2str (const DgResAdd<A>& add, char delimiter) const
                          { return dgg::util::to_string(add.res()) + delimiter +
-                           this->grids()[add.res()]->add2str(add.address(), delimiter); }
+                           this->grid(add.res())->add2str(add.address(), delimiter); }
 
       virtual const char* str2add (DgResAdd<A>* add, const char* str, char delimiter) const;
 
@@ -73,14 +73,14 @@ template<class A, class B, class DB> class DgDiscRFS
 
          virtual DgResAdd<A> quantify (const DgResAdd<B>& point) const
             {
-                A newAdd = (this->grids()[point.res()])->quantify(point.address());
+                A newAdd = (this->grid(point.res()))->quantify(point.address());
                 DgResAdd<A> add(newAdd, point.res());
                 return add;
              }
 
          virtual DgResAdd<B> invQuantify (const DgResAdd<A>& add) const
              {
-                 B newPt = (this->grids()[add.res()])->invQuantify(add.address());
+                 B newPt = (this->grid(add.res()))->invQuantify(add.address());
                  DgResAdd<B> point(newPt, add.res());
                  return point;
              }
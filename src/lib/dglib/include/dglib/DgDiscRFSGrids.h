@@ -25,6 +25,8 @@
 #ifndef DGDISCRFSGRIDS_H
 #define DGDISCRFSGRIDS_H
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #include <dglib/Dg2WayConverter.h>
@@ -221,35 +223,80 @@ template<template <class, class, class> class DRF, class A, class B, class DB, c
 
                    (*grids_)[i] = rf.grids()[i];
                 }
+
+                allGrids_ = true;
             }
 
             return *this;
          }
 
-      const std::vector<const DRF<A, BG, DB>*>& grids (void) const { return *grids_; }
+      // creates any grids not yet created by a lazy sub-class
+      const std::vector<const DRF<A, BG, DB>*>& grids (void) const
+                  { if (!allGrids_) makeAllGrids();
+                    return *grids_; }
+
+      // no bounds checking; creates the grid if needed
+      const DRF<A, BG, DB>* grid (int res) const
+                  { if (allGrids_) return (*grids_)[res];
+                    return makeGridLocked(res); }
 
       // no bounds checking
       const DRF<A, BG, DB>& operator[] (int res) const
-                           { return *((*grids_)[res]); }
+                           { return *grid(res); }
 
       // pure virtual from above
       virtual const DgDiscRF<A, BG, DB>& discRF (int res) const
-                           { return *((*grids_)[res]); }
+                           { return *grid(res); }
 
    protected:
 
       DgDiscRFSGrids (const DgRF<B, DB>& backFrameIn, int nResIn)
-         : DgDiscRFSGridsBase<A, B, BG, DB>(backFrameIn, nResIn), grids_ (nullptr)
+         : DgDiscRFSGridsBase<A, B, BG, DB>(backFrameIn, nResIn), grids_ (nullptr),
+           allGrids_ (true)
         {
           this->grids_ = new std::vector<const DRF<A, BG, DB>*>(this->nRes(), nullptr);
         }
 
       DgDiscRFSGrids (const DgDiscRFSGrids<DRF, A, B, DB, BG>& rf) // uses dubious operator=
         //: DgDiscRF<DgResAdd<A>, B, DB> (rf)
+        : grids_ (nullptr), allGrids_ (true)
         { *this = rf; }
 
       std::vector<const DRF<A, BG, DB>*>& gridsMutable (void) const { return *grids_; }
 
+      // sub-classes that create their grids on first access call this in
+      // their constructor and define makeGrid
+      void setLazyGrids (void) { allGrids_ = false; }
+
+      // create the grid at resolution res and store it in grids_; only
+      // called by lazy sub-classes, with the grid mutex held
+      virtual void makeGrid (int) const
+                  {
+                     report("DgDiscRFSGrids::makeGrid() not defined for "
+                            "this grid system", DgBase::Fatal);
+                  }
+
+      const DRF<A, BG, DB>* makeGridLocked (int res) const
+                  {
+                     std::lock_guard<std::recursive_mutex> lock(gridsMutex_);
+                     if (!(*grids_)[res]) {
+                        makeGrid(res);
+
+                        bool all = true;
+                        for (const auto g: *grids_)
+                           if (!g) { all = false; break; }
+                        if (all) allGrids_ = true;
+                     }
+
+                     return (*grids_)[res];
+                  }
+
+      void makeAllGrids (void) const
+                  {
+                     for (int r = 0; r < this->nRes(); r++)
+                        makeGridLocked(r);
+                  }
+
     /*
       virtual DgResAdd<A> quantifyRFS (const B& point) const
             {
@@ -278,6 +325,11 @@ template<template <class, class, class> class DRF, class A, class B, class DB, c
 
       // state data
       std::vector<const DRF<A, BG, DB>*>* grids_;
+
+   private:
+
+      mutable std::atomic<bool> allGrids_;
+      mutable std::recursive_mutex gridsMutex_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -80,7 +80,7 @@ template<class A, class B, class DB> class DgDiscTopoRFS
 
       virtual std::string add2str (const DgResAdd<A>& add, char delimiter) const
                            { return dgg::util::to_string(add.res()) + delimiter +
-                               (*(this->grids_))[add.res()]->add2str(add.address(), delimiter); }
+                               this->grid(add.res())->add2str(add.address(), delimiter); }
 
       virtual const char* str2add (DgResAdd<A>* add, const char* str, char delimiter) const;
 
@@ -94,7 +94,7 @@ template<class A, class B, class DB> class DgDiscTopoRFS
 
       // no bounds checking
       const DgDiscTopoRF<A, B, DB>& topoRF (int res) const
-        { return *(static_cast<const DgDiscTopoRF<A, B, DB>*>(this->grids()[res])); }
+        { return *(static_cast<const DgDiscTopoRF<A, B, DB>*>(this->grid(res))); }
 
       // parents
 
@@ -337,7 +337,7 @@ template<class A, class B, class DB> class DgDiscTopoRFS
                      // quantify using max res grid
                      int maxRes = this->nRes() - 1;
                      DgLocation* loc = this->backFrame().makeLocation(point);
-                     const DgDiscTopoRF<A, B, DB>& grid = *this->grids()[maxRes];
+                     const DgDiscTopoRF<A, B, DB>& grid = *this->grid(maxRes);
                      grid.convert(loc);
                      DgResAdd<A> add(*grid.getAddress(*loc), maxRes);
                      delete loc;
@@ -347,7 +347,7 @@ template<class A, class B, class DB> class DgDiscTopoRFS
 
        virtual B invQuantify (const DgResAdd<A>& add) const
                {
-                   const DgDiscTopoRF<A, B, DB>& grid = *this->grids()[add.res()];
+                   const DgDiscTopoRF<A, B, DB>& grid = *this->grid(add.res());
                    DgLocation* loc = grid.makeLocation(add.address());
                    this->backFrame().convert(loc);
                    B newAdd(*(this->backFrame().getAddress(*loc)));
@@ -357,7 +357,7 @@ template<class A, class B, class DB> class DgDiscTopoRFS
 
        virtual void setAddVertices (const DgResAdd<A>& add,
                                    DgPolygon& vec) const
-                    { this->grids()[add.res()]->backFrame().convert(vec);
+                    { this->grid(add.res())->backFrame().convert(vec);
                         topoRF(add.res()).setVertices(add.address(), vec);
                       this->backFrame().convert(vec);
 		    }
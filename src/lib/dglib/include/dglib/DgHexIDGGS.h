@@ -64,6 +64,9 @@ class DgHexIDGGS : public DgIDGGS {
                bool isMixed43 = false, int numAp4 = 0, bool isSuperfund = false,
                DgHierNdxSysType hierNdxSysType = InvalidHierNdxSysType);
 
+      // create the grid at res on first access
+      virtual DgIDGGBase* makeIDGG (int res) const;
+
       // pure virtual functions remaining from above
 
       virtual void setAddParents (const DgResAdd<DgQ2DICoord>& add,
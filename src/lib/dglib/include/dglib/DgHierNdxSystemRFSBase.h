@@ -63,6 +63,15 @@ class DgHierNdxSystemRFSBase :
       void setOutModeInt (bool extModeIntIn = true)
                { extModeInt_ = extModeIntIn; }
 
+      // systems that can convert directly between Q2DI coordinates and
+      // their integer form override these; otherwise quantification goes
+      // through the string form
+      virtual bool hasIntCodec (void) const { return false; }
+      virtual DgHierNdxIntCoord quantifyInt (const DgQ2DICoord& c,
+                                             int gridRes) const;
+      virtual DgQ2DICoord invQuantifyInt (const DgHierNdxIntCoord& c,
+                                          int gridRes) const;
+
       // indexing parent
       // only the DgLocation version performs checking on the input
 
@@ -31,6 +31,7 @@
 #include <dglib/DgIDGGutil.h>
 
 class DgIDGGSBase;
+class DgVertexCache;
 //class DgZ3RF;
 //class DgZ3StringRF;
 //class DgZ7System;
@@ -129,6 +130,14 @@ class DgIDGGBase : public DgDiscTopoRF<DgQ2DICoord, DgGeoCoord, long double> {
       virtual void setAddVertices (const DgQ2DICoord& add,
                                    DgPolygon& vec, int densify) const;
 
+      // as above, but boundary points found in cache are not recomputed and
+      // newly computed points are added to it
+      void setVertices (const DgLocation& loc, DgPolygon& vec, int densify,
+                        DgVertexCache* cache) const;
+
+      void setAddVertices (const DgQ2DICoord& add, DgPolygon& vec,
+                           int densify, DgVertexCache* cache) const;
+
       // we'll give dummy definitions for these since some of our IDGG's may
       // not have defined these yet
 
@@ -146,14 +155,32 @@ class DgIDGGBase : public DgDiscTopoRF<DgQ2DICoord, DgGeoCoord, long double> {
       virtual void setAddNeighborsBdry2 (const DgQ2DICoord& add,
                                     DgLocVector& vec) const;
 
-      // give dummy definitions; these will not be used but will be
-      // overridden by series converters
+      // network conversions to/from the geoRF use the series converters
+      // built in createConverters; quantify and invQuantify apply the same
+      // sequences of converters directly, without allocating intermediate
+      // addresses
+
+      virtual DgQ2DICoord quantify (const DgGeoCoord& point) const;
+
+      virtual DgGeoCoord invQuantify (const DgQ2DICoord& add) const;
+
+      // quantify the n points (lon[k], lat[k]) into out[k]; coordinates
+      // are in degrees unless rads is true
+      void quantifyBatch (const double* lon, const double* lat, size_t n,
+                          DgQ2DICoord* out, bool rads = false) const;
 
-      virtual DgQ2DICoord quantify (const DgGeoCoord&) const
-                { DgQ2DICoord v; return v; }
+      void quantifyBatch (const long double* lon, const long double* lat,
+                          size_t n, DgQ2DICoord* out, bool rads = false) const;
 
-      virtual DgGeoCoord invQuantify (const DgQ2DICoord&) const
-                { DgGeoCoord g; return g; }
+      // quantify pts[k] into out[k] for k in [0, n); the icosahedron faces
+      // of blocks of points are found at once (see DgIcosaProjFwd)
+      void quantifyBatch (const DgGeoCoord* pts, size_t n,
+                          DgQ2DICoord* out) const;
+
+      // planar conversions between this grid's addresses and the
+      // resolution-independent Q2DD quad coordinates
+      DgQ2DDCoord toQ2DD (const DgQ2DICoord& add) const;
+      DgQ2DICoord fromQ2DD (const DgQ2DDCoord& pt) const;
 
       static const DgQuadEdgeCells& edgeTable (int quadNum)
                        { return edgeTable_[quadNum]; }
@@ -213,6 +240,21 @@ class DgIDGGBase : public DgDiscTopoRF<DgQ2DICoord, DgGeoCoord, long double> {
       const DgBoundedIDGG* bndRF_;
       const DgPlaneTriRF* planeRF_;
 
+      // the forward converters, in sequence, used by quantify
+
+      const DgIcosaProjFwd* projFwd_;
+      const DgProjTriToVertex2DD* projTriToVertex_;
+      const DgVertex2DDToQ2DDConverter* vertexToQ2DD_;
+      const DgQ2DDtoIConverter* q2ddToQ2DI_;
+
+      // the inverse converters, in sequence, used by invQuantify
+
+      const DgQ2DItoDConverter* q2diToQ2DD_;
+      const DgQ2DDtoVertex2DDConverter* q2ddToVertex_;
+      const DgVertex2DDtoProjTri* vertexToProjTri_;
+      const DgConverter<DgProjTriCoord, long double,
+                        DgGeoCoord, long double>* projInv_;
+
    friend class DgQ2DItoDConverter;
    friend class DgQ2DDtoIConverter;
    friend class DgBoundedIDGG;
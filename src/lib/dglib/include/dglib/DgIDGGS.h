@@ -79,6 +79,15 @@ class DgIDGGS : public DgIDGGSBase {
                bool isSuperfund = false,
                const DgHierNdxSysType hierNdxSysType = InvalidHierNdxSysType);
 
+      // grids are created on first access; sub-classes call setLazyGrids()
+      // in their constructor and define makeIDGG
+      virtual DgIDGGBase* makeIDGG (int res) const = 0;
+
+      // create the grid at res and register its converters, including
+      // direct converters to and from every grid already created so that
+      // cross-resolution conversions stay in the quad plane
+      virtual void makeGrid (int res) const;
+
       // remind sub-classes of the pure virtual functions remaining from above
 
       virtual void setAddParents (const DgResAdd<DgQ2DICoord>& add,
@@ -61,6 +61,9 @@ class DgIDGGS4D : public DgIDGGS {
 
       DgIDGGS4D (const DgIDGGS4D& rf);
 
+      // create the grid at res on first access
+      virtual DgIDGGBase* makeIDGG (int res) const;
+
       // pure virtual functions from DgDiscRFS
 
       virtual void setAddParents (const DgResAdd<DgQ2DICoord>& add,
@@ -60,6 +60,9 @@ class DgIDGGS4T : public DgIDGGS {
 
       DgIDGGS4T (const DgIDGGS4T& rf);
 
+      // create the grid at res on first access
+      virtual DgIDGGBase* makeIDGG (int res) const;
+
       // pure virtual functions from DgDiscRFS
 
       virtual void setAddParents (const DgResAdd<DgQ2DICoord>& add,
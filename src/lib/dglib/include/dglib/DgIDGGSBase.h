@@ -28,6 +28,7 @@
 #define DGIDGGSBASE_H
 
 #include <dglib/DgIDGGBase.h>
+#include <dglib/DgProjTriRF.h>
 #include <dglib/DgDiscTopoRFS.h>
 #include <dglib/DgEllipsoidRF.h>
 #include <dglib/DgApSeq.h>
@@ -76,6 +77,15 @@ class DgIDGGSBase : public DgDiscTopoRFS<DgQ2DICoord, DgGeoCoord, long double> {
       const std::string& projType    (void) const { return projType_; }
 
       const DgHierNdxSystemRFSBase* hierNdxSystem (void) const { return hierNdxSystem_; }
+
+      // icosahedron geometry shared by the grids at all resolutions
+      DgSphIcosa& sphIcosa (void) const { return *sphIcosa_; }
+
+      // create the grids at every resolution and freeze the network, after
+      // which conversions on this grid system may be performed from multiple
+      // threads (see DgRFNetwork); no further frames may be added to the
+      // network
+      void freeze (void) const;
 /*
       DgGridTopology    gridTopo    (void) const { return gridTopo_; }
       DgGridMetric      gridMetric  (void) const { return gridMetric_; }
@@ -97,7 +107,10 @@ class DgIDGGSBase : public DgDiscTopoRFS<DgQ2DICoord, DgGeoCoord, long double> {
         : DgDiscTopoRFS<DgQ2DICoord, DgGeoCoord, long double> (network, backFrame,
                   nRes, gridTopo, gridMetric, aperture, true, false, name),
           geoRF_ (backFrame), vert0_ (vert0), azDegs_ (azDegs), hierNdxSysType_ (hierNdxSysType), hierNdxSystem_ (nullptr),
-          projType_ (projType), isPure_ (isPure) { }
+          projType_ (projType), isPure_ (isPure),
+          sphIcosa_ (new DgSphIcosa(vert0, azDegs)) { }
+
+      virtual ~DgIDGGSBase (void) { delete sphIcosa_; }
 
       // remind sub-classes of the pure virtual functions remaining from above
 
@@ -128,6 +141,8 @@ class DgIDGGSBase : public DgDiscTopoRFS<DgQ2DICoord, DgGeoCoord, long double> {
       std::string projType_;
 
       bool isPure_;
+
+      DgSphIcosa* sphIcosa_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -406,6 +406,10 @@ class DgQ2DItoDConverter :
 
       const DgIDGGBase* pIDGG_;
 
+      // direct grid2D backFrame to ccFrame converter (null if the frames
+      // are not connected by a single typed converter)
+      const DgConverter<DgDVec2D, long double, DgDVec2D, long double>* gridToCC_;
+
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -426,6 +430,34 @@ class DgQ2DDtoIConverter :
 
       const DgIDGGBase* pIDGG_;
 
+      // direct ccFrame to grid2D backFrame converter (null if the frames
+      // are not connected by a single typed converter)
+      const DgConverter<DgDVec2D, long double, DgDVec2D, long double>* ccToGrid_;
+
+      // quantize a ccFrame point into the grid2D without creating locations
+      DgIVec2D quantifyCC (const DgDVec2D& pt) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// converts directly between the Q2DI addresses of two resolutions of the same
+// DGGS through their shared Q2DD quad coordinates, without projecting to the
+// sphere
+class DgIDGGResConverter :
+        public DgConverter<DgQ2DICoord, long long int, DgQ2DICoord, long long int>
+{
+   public:
+
+      DgIDGGResConverter (const DgIDGGBase& from, const DgIDGGBase& to);
+
+      virtual DgQ2DICoord convertTypedAddress
+                                (const DgQ2DICoord& addIn) const;
+
+   protected:
+
+      const DgIDGGBase& fromIDGG_;
+      const DgIDGGBase& toIDGG_;
+
 };
 
 ////////////////////////////////////////////////////////////////////////////////
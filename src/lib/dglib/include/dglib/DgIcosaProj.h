@@ -18,7 +18,7 @@
 *******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 //
-// DgIcosaProj.h: DgIcosaProj class definitions
+// DgIcosaProj.h: DgIcosaProjFwd and DgIcosaProj class definitions
 //
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -30,13 +30,45 @@
 #include <dglib/DgGeoSphRF.h>
 #include <dglib/DgProjTriRF.h>
 
+////////////////////////////////////////////////////////////////////////////////
+// base class of the forward icosahedral projections; the face containing a
+// point is found by the DgSphIcosa and the point then projected onto it
+class DgIcosaProjFwd : public DgConverter<DgGeoCoord, long double,
+                                          DgProjTriCoord, long double> {
+
+   public:
+
+      const DgProjTriRF& projTriRF (void) const { return *pProjTriRF_; }
+
+      virtual DgProjTriCoord convertTypedAddress (const DgGeoCoord& addIn)
+                                                               const;
+
+      // project addIn, which lies on icosahedron face triNum
+      virtual DgProjTriCoord projectOnTri (const DgGeoCoord& addIn,
+                                           int triNum) const = 0;
+
+      // convert pts[k] into out[k] for k in [0, n), finding the faces of
+      // blocks of points at once
+      void convertBatch (const DgGeoCoord* pts, DgProjTriCoord* out,
+                         size_t n) const;
+
+   protected:
+
+      DgIcosaProjFwd (const DgRF<DgGeoCoord, long double>& geoRF,
+                      const DgRF<DgProjTriCoord, long double>& projTriRF);
+
+   private:
+
+      const DgProjTriRF* pProjTriRF_;
+
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 class DgIcosaProj : public Dg2WayConverter {
 
    protected:
 
-      DgIcosaProj (const DgConverter<DgGeoCoord, long double,
-                            DgProjTriCoord, long double>& forward,
+      DgIcosaProj (const DgIcosaProjFwd& forward,
                    const DgConverter<DgProjTriCoord, long double,
                             DgGeoCoord, long double>& inverse)
          : Dg2WayConverter (forward, inverse) {}
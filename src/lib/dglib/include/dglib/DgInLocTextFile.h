@@ -50,6 +50,31 @@ public:
 
     void setForceCells (bool forceCells = false) { forceCells_ = forceCells; }
 
+    // map the file into memory so that lines can be read in place with
+    // nextLine/nextBlock; returns false, leaving the file to be read as a
+    // stream, if it can't be mapped (e.g. it is a pipe or is empty)
+    bool mapFile (void);
+
+    bool isMapped (void) const { return mapData_ != nullptr; }
+
+    virtual void close (void);
+
+    // set [begin, end) to the next line of a mapped file, excluding the
+    // '\n'; returns false at the end of the file
+    bool nextLine (const char*& begin, const char*& end);
+
+    // set [begin, end) to the next block of whole lines of a mapped file,
+    // of about maxBytes bytes (but at least one line); blocks can be
+    // split into lines by independent readers using the static nextLine
+    bool nextBlock (unsigned long long int maxBytes, const char*& begin,
+                    const char*& end);
+
+    // set [begin, end) to the line starting at pos in the block ending at
+    // blockEnd and advance pos to the following line; returns false if
+    // pos is at the end of the block
+    static bool nextLine (const char*& pos, const char* blockEnd,
+                          const char*& begin, const char*& end);
+
     //virtual DgInLocFile& extract (DgPolygon&      poly);
     virtual DgInLocFile& extract (DgCell&         cell);
     virtual DgInLocFile& extract (DgLocation&     loc);
@@ -63,6 +88,11 @@ private:
 
     bool forcePolyLine_;
     bool forceCells_;
+
+    // the mapped file and the position of the next line
+    const char* mapData_;
+    unsigned long long int mapSize_;
+    unsigned long long int mapPos_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -46,7 +46,7 @@ class DgOutAIGenFile : public DgOutLocTextFile {
 
       virtual ~DgOutAIGenFile (void) { if (good()) close(); }
 
-      virtual void close (void) { *this << "END" << std::endl; std::ofstream::close(); }
+      virtual void close (void) { *this << "END" << "\n"; std::ofstream::close(); }
 
       virtual DgOutLocFile& insert (DgLocation& loc, const std::string* label = nullptr,
                                 const DgDataList* dataList = nullptr);
@@ -62,14 +62,7 @@ class DgOutAIGenFile : public DgOutLocTextFile {
    protected:
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << "%#." << getPrecision() << "LF"
-             << " %#." << getPrecision() << "LF"
-             << '\n';
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat("", " ", "\n"); }
 
    private:
 
@@ -46,8 +46,11 @@ class DgOutGdalFile : public DgOutLocFile
 
    public:
 
+      static const unsigned long int defaultTransactionBatchSize;
+
       static OGRLinearRing* createLinearRing (const DgPolygon& poly);
       static OGRPolygon*    createPolygon (const DgPolygon& poly);
+      static void fillLinearRing (OGRLinearRing& ring, const DgPolygon& poly);
 
       DgOutGdalFile(const DgGeoSphDegRF& rf, const std::string& filename = "",
                const std::string& gdalDriver = "GeoJSON",
@@ -62,9 +65,13 @@ class DgOutGdalFile : public DgOutLocFile
          return true;
       }
 
-      virtual void close (void) {
-         GDALClose( _dataset );
-      }
+      virtual void close (void);
+
+      // features are written in dataset transactions of batchSize features
+      // when the driver supports transactions; 0 disables transactions.
+      // Must be called before the first feature is inserted.
+      void setTransactionBatchSize (unsigned long int batchSize)
+                  { _transactionBatchSize = batchSize; }
 
       virtual DgOutLocFile& insert (DgLocation& loc, const std::string* label = nullptr,
                                 const DgDataList* dataList = nullptr);
@@ -110,8 +117,10 @@ class DgOutGdalFile : public DgOutLocFile
 
       virtual DgOutLocFile& insert(const DgDVec2D& pt);
 
-      OGRFeature* createFeature (const std::string& label) const;
+      OGRFeature* createFeature (const std::string& label);
       OGRPoint* createPoint (const DgLocation& loc) const;
+      void setPointGeometry (OGRFeature* feature, const DgLocation& loc) const;
+      void setPolygonGeometry (OGRFeature* feature, const DgPolygon& poly) const;
       //OGRPolygon createPolygon (const DgPolygon& poly) const;
       OGRGeometryCollection* createCollection (const DgCell& cell) const;
 
@@ -122,6 +131,7 @@ class DgOutGdalFile : public DgOutLocFile
            const char* fieldName, const DgLocVector& vec, const DgRFBase* outRF);
 
       void addFeature (OGRFeature *feature);
+      void commitTransaction (void);
 
    private:
 
@@ -130,6 +140,11 @@ class DgOutGdalFile : public DgOutLocFile
       GDALDriver   *_driver;
       GDALDataset  *_dataset;
       OGRLayer     *_oLayer;
+      OGRFeature   *_feature; // reused for every feature in the layer
+
+      unsigned long int _transactionBatchSize;
+      unsigned long int _nInTransaction; // features in the open transaction
+      bool _useTransactions;
 
       std::string fileNameOnly_;
 
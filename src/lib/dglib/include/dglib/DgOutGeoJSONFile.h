@@ -69,14 +69,8 @@ class DgOutGeoJSONFile : public DgOutLocTextFile
       virtual DgOutLocFile& insert(const DgDVec2D& pt);
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << "[%#." << getPrecision() << "LF,"
-             << "%#." << getPrecision() << "LF]";
-             //<< "%#." << getPrecision() << "LF,0.0]";  // with altitude
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat("[", ",", "]"); }
+               //{ setPointFormat("[", ",", ",0.0]"); }  // with altitude
 
    private:
 
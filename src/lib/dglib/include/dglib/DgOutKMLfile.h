@@ -79,14 +79,8 @@ class DgOutKMLfile : public DgOutLocTextFile
       virtual DgOutLocFile& insert(const DgDVec2D& pt);
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << "%#." << getPrecision() << "LF,"
-             << "%#." << getPrecision() << "LF\n";
-             //<< "%#." << getPrecision() << "LF,0.0\n"; // with altitude
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat("", ",", "\n"); }
+               //{ setPointFormat("", ",", ",0.0\n"); }  // with altitude
 
       std::string color_;
       int width_;
@@ -42,6 +42,9 @@ class DgOutLocTextFile : public DgOutputStream, public DgOutLocFile {
 
       const char *formatStr() const { return formatStr_.c_str(); }
 
+      // write the point (x, y) in the format set by setPointFormat
+      void writePoint (long double x, long double y);
+
       // direct the DgOutLocFile abstract methods to the DgOutputStream ones
       virtual bool open (const std::string& fileName,
                 DgReportLevel failLevel = DgBase::Fatal)
@@ -60,7 +63,16 @@ class DgOutLocTextFile : public DgOutputStream, public DgOutLocFile {
 
       virtual void setFormatStr(void) = 0;
 
+      // points are written as prefix x sep y suffix, with x and y in fixed
+      // notation with getPrecision() digits after the decimal point; also
+      // sets formatStr_ to the equivalent printf format
+      void setPointFormat (const std::string& prefix, const std::string& sep,
+                           const std::string& suffix);
+
       std::string formatStr_;
+      std::string ptPrefix_;
+      std::string ptSep_;
+      std::string ptSuffix_;
 
    private:
 
@@ -64,13 +64,7 @@ class DgOutPRCellsFile : public DgOutLocTextFile {
       virtual DgOutLocFile& insert (const DgDVec2D& pt);
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << " %#." << getPrecision() << "LF, "
-             << "%#." << getPrecision() << "LF";
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat(" ", ", ", ""); }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -67,13 +67,7 @@ class DgOutPRPtsFile : public DgOutLocTextFile {
       virtual DgOutLocFile& insert (const DgDVec2D& pt);
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << "%#." << getPrecision() << "LF "
-             << "%#." << getPrecision() << "LF\n";
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat("", " ", "\n"); }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,13 +62,7 @@ class DgOutPtsText : public DgOutLocTextFile {
       virtual DgOutLocFile& insert (const DgDVec2D& pt);
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << "%#." << getPrecision() << "LF,"
-             << "%#." << getPrecision() << "LF\n";
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat("", ",", "\n"); }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -44,7 +44,7 @@ class DgOutRandPtsText : public DgOutLocTextFile {
 
       virtual ~DgOutRandPtsText (void) { if (good()) close(); }
 
-      virtual void close (void) { *this << "END" << std::endl; std::ofstream::close(); }
+      virtual void close (void) { *this << "END" << "\n"; std::ofstream::close(); }
 
       virtual DgOutLocFile& insert (DgLocation& loc, const std::string* label = nullptr,
                                 const DgDataList* dataList = nullptr);
@@ -62,13 +62,7 @@ class DgOutRandPtsText : public DgOutLocTextFile {
       virtual DgOutLocFile& insert (const DgDVec2D& pt);
 
       virtual void setFormatStr(void)
-      {
-          std::ostringstream os;
-          os << "%#." << getPrecision() << "LF, "
-             << "%#." << getPrecision() << "LF\n";
-
-          formatStr_ = os.str();
-      }
+               { setPointFormat("", ", ", "\n"); }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
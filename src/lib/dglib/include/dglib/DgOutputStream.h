@@ -33,6 +33,7 @@
 #endif
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <dglib/DgBase.h>
 
@@ -41,13 +42,17 @@ class DgOutputStream : public std::ofstream, public DgBase {
 
    public:
 
+      // size of the stream buffer; the file is only written when the
+      // buffer fills or the stream is flushed or closed
+      static const std::size_t bufferSize = 1 << 20;
+
       DgOutputStream (void) : DgBase ("DgOutputStream") {}
 
       DgOutputStream (const std::string& fileName,
                       const std::string& suffix    = std::string(""),
                       DgReportLevel failLevel = DgBase::Fatal);
 
-     ~DgOutputStream (void) { close(); }
+     ~DgOutputStream (void);
 
     bool open (std::string fileName, DgReportLevel failLevel = DgBase::Fatal);
 
@@ -62,6 +67,8 @@ class DgOutputStream : public std::ofstream, public DgBase {
 
       std::string fileName_;
       std::string suffix_;
+
+      std::vector<char> buffer_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -43,22 +43,15 @@
 #include <iostream>
 
 ////////////////////////////////////////////////////////////////////////////////
-class DgProjFullerFwd : public DgConverter<DgGeoCoord, long double,
-                                        DgProjTriCoord, long double> {
+class DgProjFullerFwd : public DgIcosaProjFwd {
 
    public:
 
       DgProjFullerFwd (const DgRF<DgGeoCoord, long double>& geoRF,
                        const DgRF<DgProjTriCoord, long double>& projTriRF);
 
-      const DgProjTriRF& projTriRF (void) const { return *pProjTriRF_; }
-
-      virtual DgProjTriCoord convertTypedAddress (const DgGeoCoord& addIn)
-                                                               const;
-
-   private:
-
-      const DgProjTriRF* pProjTriRF_;
+      virtual DgProjTriCoord projectOnTri (const DgGeoCoord& addIn,
+                                           int triNum) const;
 
 };
 
@@ -94,6 +87,7 @@ class DgProjFuller : public DgIcosaProj {
 };
 
 IcosaGridPt fullerFwd (const GeoCoord& ll, DgSphIcosa& sphicosa);
+IcosaGridPt fullerFwd (const GeoCoord& ll, DgSphIcosa& sphicosa, int tri);
 GeoCoord fullerInv (const IcosaGridPt& pt, SphIcosa& sphicosa);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -43,22 +43,15 @@
 #include <iostream>
 
 ////////////////////////////////////////////////////////////////////////////////
-class DgProjISEAFwd : public DgConverter<DgGeoCoord, long double,
-                                        DgProjTriCoord, long double> {
+class DgProjISEAFwd : public DgIcosaProjFwd {
 
    public:
 
       DgProjISEAFwd (const DgRF<DgGeoCoord, long double>& geoRF,
                        const DgRF<DgProjTriCoord, long double>& projTriRF);
 
-      const DgProjTriRF& projTriRF (void) const { return *pProjTriRF_; }
-
-      virtual DgProjTriCoord convertTypedAddress (const DgGeoCoord& addIn)
-                                                               const;
-
-   private:
-
-      const DgProjTriRF* pProjTriRF_;
+      virtual DgProjTriCoord projectOnTri (const DgGeoCoord& addIn,
+                                           int triNum) const;
 
 };
 
@@ -98,9 +91,23 @@ class DgProjISEA : public DgIcosaProj {
 Vec2D sllxy (const GeoCoord& Geovect, SphIcosa& sphico,
              int tri);
 
+/* use the double precision kernels if sphicosa is in fast precision mode;
+   the second projects ll onto the known icosahedron face tri */
 IcosaGridPt snyderFwd (const GeoCoord& ll, DgSphIcosa& sphicosa);
+IcosaGridPt snyderFwd (const GeoCoord& ll, DgSphIcosa& sphicosa, int tri);
+
+/* if interpolate is true the azimuth is interpolated from a table rather
+   than solved for iteratively; see DgSphIcosa::Interpolated */
+GeoCoord snyderInv (const IcosaGridPt& pt, SphIcosa& sphicosa,
+                    bool interpolate = false);
+
+/* double precision versions of the above */
+
+Vec2D sllxyFast (const GeoCoord& Geovect, SphIcosa& sphico,
+             int tri);
 
-GeoCoord snyderInv (const IcosaGridPt& pt, SphIcosa& sphicosa);
+GeoCoord snyderInvFast (const IcosaGridPt& pt, SphIcosa& sphicosa,
+                        bool interpolate = false);
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
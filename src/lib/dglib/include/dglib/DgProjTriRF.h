@@ -40,22 +40,66 @@ class DgSphIcosa {
 
    public:
 
+      // Exact evaluates the ISEA projection kernels in long double; Fast
+      // evaluates them in double, which is several times faster on x86-64.
+      // The fast forward projection agrees with the exact one to within
+      // about a micrometer on the earth and the fast inverse to within a
+      // millimeter
+      enum DgPrecisionMode { Exact, Fast };
+
+      // Iterative solves for the azimuth in the inverse ISEA projection by
+      // Newton's method for every point; Interpolated interpolates it from
+      // a precomputed table, moving the inverse projected points by less
+      // than 0.1 micrometer on the earth
+      enum DgInverseMethod { Iterative, Interpolated };
+
       DgSphIcosa (const DgGeoCoord& vert0 =
                                       DgGeoCoord(11.25L, 58.28252559L, false),
                   long double azimuthDegs = M_ZERO);
 
       SphIcosa& sphIcosa (void) { return sphIcosa_; }
 
+      // must be set before any conversions are performed
+      DgPrecisionMode precisionMode (void) const { return precisionMode_; }
+      void setPrecisionMode (DgPrecisionMode mode) { precisionMode_ = mode; }
+      bool isFast (void) const { return precisionMode_ == Fast; }
+
+      // must be set before any conversions are performed
+      DgInverseMethod inverseMethod (void) const { return inverseMethod_; }
+      void setInverseMethod (DgInverseMethod method)
+                                             { inverseMethod_ = method; }
+      bool isInterpolatedInverse (void) const
+                                 { return inverseMethod_ == Interpolated; }
+
       /* give the start point and an azimuth, return 12 vertices
          of the icosahedron */
       void ico12verts(void);
 
-      int whichIcosaTri (const GeoCoord& pt);
+      // return the index of the face whose center is closest to pt, found
+      // by comparing the dot products of the unit vectors of pt and the
+      // face centers
+      int whichIcosaTri (const GeoCoord& pt) const;
+
+      // set tris[k] to whichIcosaTri(pts[k]) for k in [0, n); in Fast
+      // precision mode the dot products are computed for blocks of points
+      // at once in a loop the compiler can vectorize
+      void whichIcosaTri (const GeoCoord* pts, int* tris, size_t n) const;
 
    private:
 
       SphIcosa sphIcosa_;
 
+      DgPrecisionMode precisionMode_;
+
+      DgInverseMethod inverseMethod_;
+
+      // face center unit vectors, stored by component so the batch face
+      // lookup vectorizes
+      long double cenX_[20], cenY_[20], cenZ_[20];
+      double cenXd_[20], cenYd_[20], cenZd_[20];
+
+      void whichIcosaTriFast (const GeoCoord* pts, int* tris, size_t n) const;
+
       friend std::ostream& operator<< (std::ostream& stream, const DgSphIcosa& dgsi);
 };
 
@@ -27,6 +27,9 @@
 
 #include <dglib/DgUtil.h>
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 class DgLocation;
@@ -34,19 +37,42 @@ class DgRFBase;
 class DgConverterBase;
 
 ////////////////////////////////////////////////////////////////////////////////
+//
+// Converters are kept in a sparse registry keyed on their from/to frames,
+// so memory use and the cost of update() scale with the number of
+// converters that have been created rather than with the square of the
+// number of frames.
+//
+// Access to the converter registry is serialized by an internal lock, so
+// conversions on a network may be performed from multiple threads. Series
+// converters are still generated lazily on first use.
+//
+// Once freeze() has been called a converter exists between every pair of
+// connected frames and the network is read-only: getConverter() and the
+// convert() methods of the network's frames and converters take no lock and
+// are safe to call from any number of threads concurrently. Creating frames
+// or converters on a frozen network is a fatal error. (Conversion tracing,
+// if turned on, writes every thread's output to the same trace stream.)
+//
 class DgRFNetwork {
 
    public:
 
       DgRFNetwork (int chunkSize = 10)
-         : nextId_ (0), chunkSize_ (chunkSize) { reserve(chunkSize_); }
+         : nextId_ (0), chunkSize_ (chunkSize), frozen_ (false)
+           { reserve(chunkSize_); }
 
-      DgRFNetwork (const DgRFNetwork& net) { operator=(net); }
+      DgRFNetwork (const DgRFNetwork& net) : frozen_ (false) { operator=(net); }
 
      ~DgRFNetwork (void);
 
       unsigned long long int size (void) const { return frames_.size(); }
 
+      // number of converters created so far, including identities
+      unsigned long long int numConverters (void) const
+           { std::lock_guard<std::recursive_mutex> lock(mutex_);
+             return converters_.size(); }
+
       bool existsConverter (const DgRFBase& fromFrame,
                             const DgRFBase& toFrame) const;
 
@@ -58,6 +84,13 @@ class DgRFNetwork {
 
       void update (void);
 
+      // build every remaining series converter and make the network
+      // read-only (see above)
+      void freeze (void);
+
+      bool isFrozen (void) const
+                 { return frozen_.load(std::memory_order_acquire); }
+
       DgRFNetwork& operator= (const DgRFNetwork& net)
             { chunkSize_ = net.chunkSize_; return *this; }
 
@@ -83,10 +116,33 @@ class DgRFNetwork {
 
       std::vector< DgRFBase* > frames_;
 
-      std::vector< std::vector<DgConverterBase*> > matrix_;
+      // the converters, including the identity converter of each frame,
+      // keyed on converterKey(fromId, toId)
+      std::unordered_map<unsigned long long int, DgConverterBase*> converters_;
+
+      // serializes access to frames_ and converters_ until the network is
+      // frozen
+      mutable std::recursive_mutex mutex_;
+
+      std::atomic<bool> frozen_;
 
       int generateId (DgRFBase* frame);
 
+      static unsigned long long int converterKey (int fromId, int toId)
+           { return ((unsigned long long int) fromId << 32) |
+                     (unsigned int) toId; }
+
+      // the converter between the frames or nullptr; the caller must hold
+      // the lock if the network isn't frozen
+      DgConverterBase* findConverter (int fromId, int toId) const
+           { auto it = converters_.find(converterKey(fromId, toId));
+             return (it == converters_.end()) ? nullptr : it->second; }
+
+      // replaces the converter between the frames, returning the old one
+      // (or nullptr); the caller must hold the lock
+      DgConverterBase* setConverter (int fromId, int toId,
+                                     DgConverterBase* conv);
+
    friend class DgConverterBase;
    friend class DgRFBase;
    friend class DgSeriesConverter;
@@ -107,12 +107,29 @@ inline long lrint(const long double& x)
 #endif
 }
 
+// reentrant strtok; *save holds the parse position between calls
+char* nextToken(char* str, const char* delim, char** save);
+
 void ssplit(const char *& src, std::vector<std::string>& dest, const char *delim = " ");
 void ssplit(const std::string& src, std::vector<std::string>& dest, const char *delim = " ");
 std::string stripQuotes (const std::string& str, char quote = '"');
 std::string baseName (const std::string& path);
 std::string toUpper (const std::string& str);
 
+// write val to buf as printf's "%#.<prec>LF" would, without the overhead of
+// parsing a format string in the common case; returns the number of
+// characters written (excluding the terminating null) as snprintf does
+int fixedToStr (char* buf, int bufSize, long double val, int prec);
+
+// parse the decimal number at the start of [first, last) as strtod/strtold
+// would, without requiring a terminating null; returns a pointer past the
+// number. Returns first if the text is not a plain decimal number or can't
+// be converted exactly without arbitrary precision (more than 19
+// significant digits, or a large exponent); callers should then fall back
+// on strtod/strtold.
+const char* fromChars (const char* first, const char* last, double& val);
+const char* fromChars (const char* first, const char* last, long double& val);
+
 }} // namespace dgg::util
 
 #endif
@@ -0,0 +1,115 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgVertexCache.h: DgVertexCache class definitions
+//
+// A bounded cache of the geoRF coordinates of cell boundary points (vertices
+// and densification points) of a single DGG, keyed by quad number and
+// position in the quad's ccFrame. Cells generated in sequence share most of
+// their boundary points with recently generated cells, so each shared point
+// need only be inverse projected once.
+//
+// Positions are keyed on their exact ccFrame coordinates, so a cached point
+// is only reused where the same point would have been computed anyway and
+// the output is unchanged by the cache.
+//
+// A cache is not thread-safe; each thread should use its own.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DGVERTEXCACHE_H
+#define DGVERTEXCACHE_H
+
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+#include <dglib/DgDVec2D.h>
+#include <dglib/DgGeoSphRF.h>
+
+class DgIDGGBase;
+
+////////////////////////////////////////////////////////////////////////////////
+class DgVertexCache {
+
+   public:
+
+      struct DgVertexVal {
+         DgGeoCoord geo;
+         bool keep;    // the vertexRF keep flag
+      };
+
+      // the cache holds at most 2 * genSize points
+      DgVertexCache (size_t genSize = 1 << 15) : dgg_ (nullptr),
+                     genSize_ (genSize), nHits_ (0), nMisses_ (0) { }
+
+      // clear the cache if dgg is not the DGG it currently holds points for
+      void setDgg (const DgIDGGBase& dgg);
+
+      const DgVertexVal* find (int quadNum, const DgDVec2D& pt);
+      void insert (int quadNum, const DgDVec2D& pt, const DgVertexVal& val);
+
+      void clear (void);
+
+      unsigned long long int nHits   (void) const { return nHits_; }
+      unsigned long long int nMisses (void) const { return nMisses_; }
+
+   private:
+
+      struct Key {
+         int quadNum;
+         long double x;
+         long double y;
+
+         // exact comparison (including the sign of zero), so a cached
+         // point is only reused for bitwise the same input coordinates
+         bool operator== (const Key& k) const
+               { return x == k.x && y == k.y && quadNum == k.quadNum &&
+                        std::signbit(x) == std::signbit(k.x) &&
+                        std::signbit(y) == std::signbit(k.y); }
+      };
+
+      struct KeyHash {
+         size_t operator() (const Key& k) const
+            { return (size_t) (std::hash<long double>()(k.x) * 0x9E3779B97F4A7C15ULL) ^
+                     (size_t) (std::hash<long double>()(k.y) * 0xC2B2AE3D27D4EB4FULL) ^
+                     (size_t) k.quadNum; }
+      };
+
+      typedef std::unordered_map<Key, DgVertexVal, KeyHash> Generation;
+
+      Key makeKey (int quadNum, const DgDVec2D& pt) const;
+
+      const DgIDGGBase* dgg_;
+      size_t genSize_;
+
+      // new points go in cur_; when it fills it replaces prev_, so the
+      // most recently used points are retained
+      Generation cur_;
+      Generation prev_;
+
+      unsigned long long int nHits_;
+      unsigned long long int nMisses_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -41,16 +41,18 @@ class DgZ3System : public DgHierNdxSystemRFS<DgZ3RF, DgZ3StringRF> {
           return new DgZ3System (dggsIn, extModeIntIn, nameIn);
       }
 
+      // direct conversion between Q2DI coordinates and Z3 integer indexes
+      virtual bool hasIntCodec (void) const { return true; }
+      virtual DgHierNdxIntCoord quantifyInt (const DgQ2DICoord& c,
+                                             int gridRes) const;
+      virtual DgQ2DICoord invQuantifyInt (const DgHierNdxIntCoord& c,
+                                          int gridRes) const;
+
    protected:
 
      DgZ3System (const DgIDGGSBase& dggsIn, bool extModeIntIn = true,
                  const std::string& nameIn = "Z3System");
 
-     // default methods quantize via string representation; redefine to
-     // get different behavior
-     //virtual DgHierNdx quantify (const DgQ2DICoord& point) const;
-     //virtual DgQ2DICoord invQuantify (const DgHierNdx& add) const;
-
      // abstract methods from above
 
      virtual DgHierNdxIntCoord toIntCoord (const DgHierNdxStringCoord& c,
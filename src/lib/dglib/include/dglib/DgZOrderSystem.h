@@ -39,16 +39,18 @@ class DgZOrderSystem : public DgHierNdxSystemRFS<DgZOrderRF, DgZOrderStringRF> {
           return new DgZOrderSystem (dggsIn, extModeIntIn, nameIn);
       }
 
+      // direct conversion between Q2DI coordinates and ZORDER integer indexes
+      virtual bool hasIntCodec (void) const { return true; }
+      virtual DgHierNdxIntCoord quantifyInt (const DgQ2DICoord& c,
+                                             int gridRes) const;
+      virtual DgQ2DICoord invQuantifyInt (const DgHierNdxIntCoord& c,
+                                          int gridRes) const;
+
    protected:
 
      DgZOrderSystem (const DgIDGGSBase& dggsIn, bool extModeIntIn = true,
                  const std::string& nameIn = "ZOrderSystem");
 
-     // default methods quantize via string representation; redefine to
-     // get different behavior
-     //virtual DgHierNdx quantify (const DgQ2DICoord& point) const;
-     //virtual DgQ2DICoord invQuantify (const DgHierNdx& add) const;
-
      // abstract methods from above
 
      virtual DgHierNdxIntCoord toIntCoord (const DgHierNdxStringCoord& c,
@@ -27,12 +27,12 @@
 #include <dglib/DgConverterBase.h>
 
 #if DGDEBUG
-bool DgConverterBase::isTraceOn_ = true;
+std::atomic<bool> DgConverterBase::isTraceOn_(true);
 #else
-bool DgConverterBase::isTraceOn_ = false;
+std::atomic<bool> DgConverterBase::isTraceOn_(false);
 #endif
 
-std::ostream* DgConverterBase::traceStream_ = &dgcout;
+std::atomic<std::ostream*> DgConverterBase::traceStream_(&dgcout);
 
 ////////////////////////////////////////////////////////////////////////////////
 DgConverterBase::~DgConverterBase (void)
@@ -60,18 +60,20 @@ DgConverterBase::DgConverterBase (const DgRFBase& fromFrame,
 
    if (userGenerated())
    {
-      // override any existing converter
-
-      if (fromFrame.network_->existsConverter(fromFrame, toFrame))
+      if (fromFrame.network().isFrozen())
       {
-         delete const_cast<DgRFNetwork*>(fromFrame.network_)
-                           ->matrix_[fromFrame.id()][toFrame.id()];
+         report("DgConverterBase::DgConverterBase() network is frozen",
+                DgBase::Fatal);
+         return;
       }
 
-      // if we're here we're neither a passthrough nor an identity converter
+      std::lock_guard<std::recursive_mutex> lock(fromFrame.network_->mutex_);
 
-      const_cast<DgRFNetwork*>(fromFrame.network_)
-                           ->matrix_[fromFrame.id()][toFrame.id()] = this;
+      // if we're here we're neither a passthrough nor an identity converter;
+      // override any existing converter
+
+      delete fromFrame.network_->setConverter(fromFrame.id(), toFrame.id(),
+                                              this);
 
       // make any connections this gives us; note we are indirectly changing
       // the const frames here
@@ -113,11 +115,16 @@ DgConverterBase::forceConnectFrom (bool verify) const
               DgBase::Fatal);
    }
 
+   if (fromFrame_->network().isFrozen())
+      report("DgConverter::forceConnectFrom() network is frozen",
+              DgBase::Fatal);
+
+   std::lock_guard<std::recursive_mutex> lock(fromFrame_->network().mutex_);
+
    toFrame_->connectFrom_ = fromFrame_;
 
-   const_cast<DgRFNetwork&>(fromFrame_->network()).matrix_
-                                    [fromFrame_->id()][toFrame_->id()]
-                                          = const_cast<DgConverterBase*>(this);
+   fromFrame_->network().setConverter(fromFrame_->id(), toFrame_->id(),
+                                      const_cast<DgConverterBase*>(this));
 
 } // void DgConverterBase::forceConnectFrom
 
@@ -131,11 +138,16 @@ DgConverterBase::forceConnectTo (bool /* verify */) const
               DgBase::Fatal);
    }
 
+   if (fromFrame_->network().isFrozen())
+      report("DgConverter::forceConnectTo() network is frozen",
+              DgBase::Fatal);
+
+   std::lock_guard<std::recursive_mutex> lock(fromFrame_->network().mutex_);
+
    fromFrame_->connectTo_ = toFrame_;
 
-   const_cast<DgRFNetwork&>(fromFrame_->network()).matrix_
-                                    [fromFrame_->id()][toFrame_->id()]
-                                          = const_cast<DgConverterBase*>(this);
+   fromFrame_->network().setConverter(fromFrame_->id(), toFrame_->id(),
+                                      const_cast<DgConverterBase*>(this));
 
 } // void DgConverterBase::forceConnectTo
 
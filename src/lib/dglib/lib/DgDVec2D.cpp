@@ -56,13 +56,14 @@ DgDVec2D::fromString (const char* str, char delimiter)
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
 
    char* tok;
 
    // get the x
 
-   tok = strtok(tmpStr, delimStr);
+   tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    long double xIn = 0.0;
    if (!tok || sscanf(tok, "%LF", &xIn) != 1)
    {
@@ -71,7 +72,7 @@ DgDVec2D::fromString (const char* str, char delimiter)
    }
 
    // get the y
-   tok = strtok(NULL, delimStr);
+   tok = dgg::util::nextToken(NULL, delimStr, &tokPos);
    long double yIn = 0.0;
    if (!tok || sscanf(tok, "%LF", &yIn) != 1)
    {
@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <dglib/DgRF.h>
+#include <dglib/DgUtil.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////
@@ -42,10 +43,11 @@ DgDiscRFS<A, B, DB>::str2add (DgResAdd<A>* add, const char* str,
    strcpy(tmpStr, str);
 
    char* tok;
+   char* tokPos = 0;
 
    // get the resolution
 
-   tok = strtok(tmpStr, delimStr);
+   tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    int res;
    if (sscanf(tok, "%d", &res) != 1)
    {
@@ -56,9 +58,9 @@ DgDiscRFS<A, B, DB>::str2add (DgResAdd<A>* add, const char* str,
    // now get the address
 
    const char* tmp = &(str[strlen(tok) + 1]);
-   DgLocation tloc(*this->grids()[res]);
+   DgLocation tloc(*this->grid(res));
    tmp = tloc.fromString(tmp, delimiter);
-   const A& subAdd = *this->grids()[res]->getAddress(tloc);
+   const A& subAdd = *this->grid(res)->getAddress(tloc);
    *add = DgResAdd<A>(subAdd, res);
 
    return tmp;
@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <dglib/DgRF.h>
+#include <dglib/DgUtil.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 template<class A, class B, class DB>
@@ -40,10 +41,11 @@ DgDiscTopoRFS<A, B, DB>::str2add (DgResAdd<A>* add, const char* str,
    strcpy(tmpStr, str);
 
    char* tok;
+   char* tokPos = 0;
 
    // get the resolution
 
-   tok = strtok(tmpStr, delimStr);
+   tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    int res;
    if (sscanf(tok, "%d", &res) != 1)
    {
@@ -54,9 +56,9 @@ DgDiscTopoRFS<A, B, DB>::str2add (DgResAdd<A>* add, const char* str,
    // now get the address
 
    const char* tmp = &(str[strlen(tok) + 1]);
-   DgLocation tloc(*this->grids()[res]);
+   DgLocation tloc(*this->grid(res));
    tmp = tloc.fromString(tmp, delimiter);
-   const A& subAdd = *(this->grids()[res]->getAddress(tloc));
+   const A& subAdd = *(this->grid(res)->getAddress(tloc));
    *add = DgResAdd<A>(subAdd, res);
 
    return tmp;
@@ -68,7 +70,7 @@ template<class A, class B, class DB> void
 DgDiscTopoRFS<A, B, DB>::setAddNeighbors (const DgResAdd<A>& add,
                                             DgLocVector& vec) const
 {
-   this->grids()[add.res()]->convert(vec);
+   this->grid(add.res())->convert(vec);
    topoRF(add.res()).setAddNeighbors(add.address(), vec);
    this->convert(vec);
 
@@ -86,7 +88,7 @@ DgDiscTopoRFS<A, B, DB>::setParents (int res, const DgLocation& loc,
    if (res > 0 && res < this->nRes())
    {
       DgLocation tmpLoc(loc);
-      this->grids()[res]->convert(&tmpLoc);
+      this->grid(res)->convert(&tmpLoc);
       this->convert(&tmpLoc);
       setAddParents(*(this->getAddress(tmpLoc)), vec);
    }
@@ -105,7 +107,7 @@ DgDiscTopoRFS<A, B, DB>::setInteriorChildren (int res, const DgLocation& loc,
    if (res >= 0 && res < (this->nRes() - 1))
    {
       DgLocation tmpLoc(loc);
-      this->grids()[res]->convert(&tmpLoc);
+      this->grid(res)->convert(&tmpLoc);
       this->convert(&tmpLoc);
       setAddInteriorChildren(*(this->getAddress(tmpLoc)), vec);
    }
@@ -123,7 +125,7 @@ DgDiscTopoRFS<A, B, DB>::setBoundaryChildren (int res, const DgLocation& loc,
    if (res >= 0 && res < (this->nRes() - 1))
    {
       DgLocation tmpLoc(loc);
-      this->grids()[res]->convert(&tmpLoc);
+      this->grid(res)->convert(&tmpLoc);
       this->convert(&tmpLoc);
       setAddBoundaryChildren(*(this->getAddress(tmpLoc)), vec);
    }
@@ -140,7 +142,7 @@ DgDiscTopoRFS<A, B, DB>::setBoundary2Children (int res, const DgLocation& loc,
    if (res >= 0 && res < (this->nRes() - 1))
    {
       DgLocation tmpLoc(loc);
-      this->grids()[res]->convert(&tmpLoc);
+      this->grid(res)->convert(&tmpLoc);
       this->convert(&tmpLoc);
       setAddBoundary2Children(*(this->getAddress(tmpLoc)), vec);
    }
@@ -159,7 +161,7 @@ DgDiscTopoRFS<A, B, DB>::setAllChildren (int res, const DgLocation& loc,
    if (res >= 0 && res < (this->nRes() - 1))
    {
       DgLocation tmpLoc(loc);
-      this->grids()[res]->convert(&tmpLoc);
+      this->grid(res)->convert(&tmpLoc);
       this->convert(&tmpLoc);
       setAddAllChildren(*(this->getAddress(tmpLoc)), vec);
    }
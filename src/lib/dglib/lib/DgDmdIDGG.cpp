@@ -87,7 +87,7 @@ DgDmdIDGG::initialize (void)
 
    // create some internal data structures
    setUndefLoc(makeLocation(undefAddress()));
-   sphIcosa_ = new DgSphIcosa(vert0(), azDegs());
+   sphIcosa_ = &dggs()->sphIcosa();
 
    isAligned_ = false;
    isCongruent_ = false;
@@ -96,12 +96,14 @@ DgDmdIDGG::initialize (void)
    long double parentScaleFac = 1.0;
    unsigned long long int parentNCells = 1;
 
-   // get actual parent values if there is a parent grid
+   // get actual parent values if there is a parent grid; these follow
+   // from the aperture 4 sequence, so the parent grid need not be created
    if (res() > 0) {
-      const DgDmdIDGG& parentIDGG = dmdDggs().dmdIdgg(res() - 1);
-
-      parentScaleFac = parentIDGG.scaleFac();
-      parentNCells = parentIDGG.gridStats().nCells();
+      parentNCells = 10;
+      for (int r = 1; r < res(); r++) {
+         parentScaleFac *= 2.0L;
+         parentNCells *= 4;
+      }
    }
 
    // set-up local network to scale so that quad (and consequently dmd) edge
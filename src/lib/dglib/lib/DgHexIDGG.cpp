@@ -87,7 +87,7 @@ DgHexIDGG::initialize (void)
 
    // create some internal data structures
    setUndefLoc(makeLocation(undefAddress()));
-   sphIcosa_ = new DgSphIcosa(vert0(), azDegs());
+   sphIcosa_ = &dggs()->sphIcosa();
 
    radix_ = (int) sqrt((long double) aperture());
 
@@ -100,15 +100,32 @@ DgHexIDGG::initialize (void)
    long double parentScaleFac = 1.0;
    unsigned long long int parentNCells = 1;
 
-   // get actual parent values if there is a parent grid
+   // get actual parent values if there is a parent grid; these follow
+   // from the aperture sequence, so the parent grid need not be created
    if (res() > 0)
    {
-      const DgHexIDGG& parentIDGG = hexDggs().hexIdgg(res() - 1);
-
-      parentIsClassI = parentIDGG.isClassI();
-      parentIsClassIII = parentIDGG.isClassIII();
-      parentScaleFac = parentIDGG.scaleFac();
-      parentNCells = parentIDGG.gridStats().nCells();
+      parentNCells = 12;
+      for (int r = 1; r < res(); r++)
+      {
+         int ap = hexDggs().apSeq().getAperture(r).aperture();
+
+         double factor = parentScaleFac;
+         if (ap == 3)
+         {
+            parentIsClassI = !parentIsClassI;
+            factor *= M_SQRT3;
+         }
+         else if (ap == 4)
+            factor *= 2.0L;
+         else if (ap == 7)
+         {
+            parentIsClassIII = !parentIsClassIII;
+            factor *= M_SQRT7;
+         }
+
+         parentScaleFac = factor;
+         parentNCells = (parentNCells - 2) * ap + 2;
+      }
    }
 
    // set our values
@@ -84,24 +84,8 @@ DgHexIDGGS::DgHexIDGGS (DgRFNetwork& network, const DgGeoSphRF& backFrame,
    isAligned_ = true;
    isCongruent_ = false;
 
-   // create the DGGs
-
-   // make res 0 ap 4 so it will be Class I
-   (*grids_)[0] = new DgHexIDGG(*this, 4, 0, name + dgg::util::to_string(0, 2));
-   //cout << "========================\nRES 0: " << hexIdgg(0);
-
-   for (int r = 1; r < nRes; r++)
-   {
-      int ap = apSeq_.getAperture(r).aperture();
-
-      (*grids_)[r] = new DgHexIDGG(*this, ap, r,
-                                   name + dgg::util::to_string(r, 2));
-   //cout << "========================\nRES " << r << ": " << hexIdgg(r);
-   }
-
-   for (int r = 0; r < nRes; r++)
-       Dg2WayTopoResAddConverter<DgQ2DICoord, DgGeoCoord, long double>(*this, *(grids()[r]), r);
-
+   // the DGGs are created on first access by makeIDGG
+   setLazyGrids();
 
     // create the hierarchical indexing system
      if (hierNdxSysType != InvalidHierNdxSysType) {
@@ -110,6 +94,17 @@ DgHexIDGGS::DgHexIDGGS (DgRFNetwork& network, const DgGeoSphRF& backFrame,
 
 } // DgHexIDGGS::DgHexIDGGS
 
+////////////////////////////////////////////////////////////////////////////////
+DgIDGGBase*
+DgHexIDGGS::makeIDGG (int res) const
+{
+   // make res 0 ap 4 so it will be Class I
+   int ap = (res == 0) ? 4 : apSeq_.getAperture(res).aperture();
+
+   return new DgHexIDGG(*this, ap, res, name() + dgg::util::to_string(res, 2));
+
+} // DgIDGGBase* DgHexIDGGS::makeIDGG
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 void
@@ -117,13 +112,13 @@ DgHexIDGGS::setAddParents (const DgResAdd<DgQ2DICoord>& add,
                              DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res()]->setVertices(*tmpLoc, verts);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res())->setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // vertices lie in parents
 
-   grids()[add.res() - 1]->convert(verts);
+   grid(add.res() - 1)->convert(verts);
 
    for (int i = 0; i < verts.size(); i++)
    {
@@ -151,8 +146,8 @@ DgHexIDGGS::setAddInteriorChildren (const DgResAdd<DgQ2DICoord>& add,
 {
    // single center hex at next res
    DgLocVector verts;
-   DgLocation* centerLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res() + 1]->convert(centerLoc);
+   DgLocation* centerLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res() + 1)->convert(centerLoc);
    vec.push_back(*centerLoc);
 
    delete centerLoc;
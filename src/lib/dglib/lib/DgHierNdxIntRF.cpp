@@ -31,6 +31,7 @@
 #include <string.h>
 
 #include <dglib/DgHierNdxIntRF.h>
+#include <dglib/DgUtil.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 DgHierNdxIntCoord::DgHierNdxIntCoord (void)
@@ -58,8 +59,9 @@ DgHierNdxIntRF::str2add (DgHierNdxIntCoord* c, const char* str,
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
-   char* tok = strtok(tmpStr, delimStr);
+   char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
 
    // convert to a unit64_t
    uint64_t val = 0;
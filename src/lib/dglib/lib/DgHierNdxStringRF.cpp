@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <dglib/DgHierNdxStringRF.h>
+#include <dglib/DgUtil.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 DgHierNdxStringCoord::DgHierNdxStringCoord (void)
@@ -41,8 +42,9 @@ DgHierNdxStringRF::str2add (DgHierNdxStringCoord* add, const char* str,
     delimStr[1] = '\0';
 
     char* tmpStr = new char[strlen(str) + 1];
+    char* tokPos = 0;
     strcpy(tmpStr, str);
-    char* tok = strtok(tmpStr, delimStr);
+    char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
 
     add->setValue(tok);
 
@@ -185,8 +185,13 @@ DgHierNdxSystemRFBase::quantify (const DgQ2DICoord& point) const
 {
    DgHierNdx ndx(extModeInt());
 
-   ndx.strNdx_ = strRF()->quantify(point);
-   setIntFromStringCoord(ndx);
+   if (hierNdxRFS().hasIntCodec()) {
+      ndx.intNdx_ = hierNdxRFS().quantifyInt(point, res_);
+      setStringFromIntCoord(ndx);
+   } else {
+      ndx.strNdx_ = strRF()->quantify(point);
+      setIntFromStringCoord(ndx);
+   }
 
    //DgResAdd<DgHierNdx> add(ndx, res());
    //return add;
@@ -197,6 +202,9 @@ DgHierNdxSystemRFBase::quantify (const DgQ2DICoord& point) const
 DgQ2DICoord
 DgHierNdxSystemRFBase::invQuantify (const DgHierNdx& ndx) const
 {
+   if (hierNdxRFS().hasIntCodec())
+      return hierNdxRFS().invQuantifyInt(ndx.intNdx_, res_);
+
    DgQ2DICoord point(strRF()->invQuantify(ndx.strNdx_));
    //std::cout << "KEVIN: " << ndx.strNdx_ << " " << point << std::endl;
    return point;
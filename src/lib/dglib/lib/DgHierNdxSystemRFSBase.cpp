@@ -93,7 +93,7 @@ DgHierNdxSystemRFSBase::undefAddress (void) const
 const DgHierNdxSystemRFBase&
 DgHierNdxSystemRFSBase::sysRF (int res) const
 {
-    return *(static_cast<const DgHierNdxSystemRFBase*>(grids()[res]));
+    return *(static_cast<const DgHierNdxSystemRFBase*>(grid(res)));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +103,24 @@ DgHierNdxSystemRFSBase::dgg (int res) const
     return dggs().idggBase(res);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+DgHierNdxIntCoord
+DgHierNdxSystemRFSBase::quantifyInt (const DgQ2DICoord&, int) const
+{
+   ::report("DgHierNdxSystemRFSBase::quantifyInt() not defined for this "
+            "indexing system", DgBase::Fatal);
+   return DgHierNdxIntRF::undefCoord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgHierNdxSystemRFSBase::invQuantifyInt (const DgHierNdxIntCoord&, int) const
+{
+   ::report("DgHierNdxSystemRFSBase::invQuantifyInt() not defined for this "
+            "indexing system", DgBase::Fatal);
+   return DgQ2DICoord::undefDgQ2DICoord;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgHierNdxSystemRFSBase::setNdxParent (int res, const DgLocation& loc,
@@ -113,7 +131,7 @@ DgHierNdxSystemRFSBase::setNdxParent (int res, const DgLocation& loc,
 
    if (res > 0 && res < nRes()) {
       DgLocation tmpLoc(loc);
-      grids()[res]->convert(&tmpLoc);
+      grid(res)->convert(&tmpLoc);
       convert(&tmpLoc);
       setAddNdxParent(*(getAddress(tmpLoc)), parent);
    }
@@ -180,7 +198,7 @@ DgHierNdxSystemRFSBase::setNdxChildren (int res, const DgLocation& loc,
    if (res >= 0 && res < (nRes() - 1))
    {
       DgLocation tmpLoc(loc);
-      grids()[res]->convert(&tmpLoc);
+      grid(res)->convert(&tmpLoc);
       convert(&tmpLoc);
       setAddNdxChildren(*(getAddress(tmpLoc)), children);
    }
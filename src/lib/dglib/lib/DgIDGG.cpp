@@ -99,7 +99,7 @@ DgIDGG::initialize (void)
    // create some internal data structures
 
    setUndefLoc(makeLocation(undefAddress()));
-   sphIcosa_ = new DgSphIcosa(vert0(), azDegs());
+   sphIcosa_ = &dggs()->sphIcosa();
 
    // setup some parameters
 
@@ -42,6 +42,8 @@
 #include <dglib/DgRadixString.h>
 #include <dglib/DgSeriesConverter.h>
 #include <dglib/DgTriGrid2DS.h>
+#include <dglib/DgUtil.h>
+#include <dglib/DgVertexCache.h>
 #include <dglib/DgHierNdxSystemRFSBase.h>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -84,11 +86,12 @@ DgIDGGBase::str2add (DgQ2DICoord* add, const char* str, char delimiter) const
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
 
    // get the quadNum
 
-   char* tok = strtok(tmpStr, delimStr);
+   char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    if (!tok || strlen(tok) == 0)
       ::report("DgQ2DIRF::fromString() invalid input ", DgBase::Fatal);
 
@@ -121,7 +124,9 @@ DgIDGGBase::DgIDGGBase (const DgIDGGSBase* dggs, const DgGeoSphRF& geoRF,
           (geoRF.network(), geoRF, name, gridTopo, gridMetric),
      dggs_ (dggs), sphIcosa_(0), aperture_(aperture), res_(res),
      precision_(precision), grid2D_(0), grid2DS_(0), ccFrame_(0),
-     projTriRF_(0), vertexRF_(0), q2ddRF_(0), bndRF_(0), planeRF_(0)
+     projTriRF_(0), vertexRF_(0), q2ddRF_(0), bndRF_(0), planeRF_(0),
+     projFwd_(0), projTriToVertex_(0), vertexToQ2DD_(0), q2ddToQ2DI_(0),
+     q2diToQ2DD_(0), q2ddToVertex_(0), vertexToProjTri_(0), projInv_(0)
 {
    //initialize();
 
@@ -145,7 +150,7 @@ DgIDGGBase::DgIDGGBase (const DgIDGGBase& rfIn)
 ////////////////////////////////////////////////////////////////////////////////
 DgIDGGBase::~DgIDGGBase()
 {
- delete sphIcosa_;
+ // sphIcosa_ is owned by the dggs
  delete bndRF_;
 }
 
@@ -179,15 +184,26 @@ DgIDGGBase::createConverters (void)
       report("DgIDGGBase::initialize(): invalid projection type " + projType(),
              DgBase::Fatal);
 
-   const DgConverterBase* c1to2 = &(icosaProj->forward());
-   const DgConverterBase* c2to3 = new DgProjTriToVertex2DD(projTriRF(), vertexRF());
-   const DgConverterBase* c3to4 = new DgVertex2DDToQ2DDConverter(vertexRF(), q2ddRF());
-   const DgConverterBase* c4to5 = new DgQ2DDtoIConverter(q2ddRF(), *this);
+   projFwd_ = static_cast<const DgIcosaProjFwd*>(&(icosaProj->forward()));
+   projTriToVertex_ = new DgProjTriToVertex2DD(projTriRF(), vertexRF());
+   vertexToQ2DD_ = new DgVertex2DDToQ2DDConverter(vertexRF(), q2ddRF());
+   q2ddToQ2DI_ = new DgQ2DDtoIConverter(q2ddRF(), *this);
 
-   const DgConverterBase* c5to4 = new DgQ2DItoDConverter(*this, q2ddRF());
-   const DgConverterBase* c4to3 = new DgQ2DDtoVertex2DDConverter(q2ddRF(), vertexRF());
-   const DgConverterBase* c3to2 = new DgVertex2DDtoProjTri(vertexRF(), projTriRF());
-   const DgConverterBase* c2to1 = &(icosaProj->inverse());
+   const DgConverterBase* c1to2 = projFwd_;
+   const DgConverterBase* c2to3 = projTriToVertex_;
+   const DgConverterBase* c3to4 = vertexToQ2DD_;
+   const DgConverterBase* c4to5 = q2ddToQ2DI_;
+
+   q2diToQ2DD_ = new DgQ2DItoDConverter(*this, q2ddRF());
+   q2ddToVertex_ = new DgQ2DDtoVertex2DDConverter(q2ddRF(), vertexRF());
+   vertexToProjTri_ = new DgVertex2DDtoProjTri(vertexRF(), projTriRF());
+   projInv_ = static_cast<const DgConverter<DgProjTriCoord, long double,
+                       DgGeoCoord, long double>*>(&(icosaProj->inverse()));
+
+   const DgConverterBase* c5to4 = q2diToQ2DD_;
+   const DgConverterBase* c4to3 = q2ddToVertex_;
+   const DgConverterBase* c3to2 = vertexToProjTri_;
+   const DgConverterBase* c2to1 = projInv_;
 
    // done with icosaProj; the fwd/inv converters are in the RFNetwork
    delete icosaProj;
@@ -330,10 +346,116 @@ DgIDGGBase::createConverters (void)
 
 } // DgIDGGBase::createConverters
 
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgIDGGBase::quantify (const DgGeoCoord& point) const
+{
+   DgProjTriCoord tri = projFwd_->convertTypedAddress(point);
+   DgVertex2DDCoord vert = projTriToVertex_->convertTypedAddress(tri);
+   DgQ2DDCoord q2dd = vertexToQ2DD_->convertTypedAddress(vert);
+
+   return q2ddToQ2DI_->convertTypedAddress(q2dd);
+
+} // DgQ2DICoord DgIDGGBase::quantify
+
+////////////////////////////////////////////////////////////////////////////////
+DgGeoCoord
+DgIDGGBase::invQuantify (const DgQ2DICoord& add) const
+{
+   DgQ2DDCoord q2dd = q2diToQ2DD_->convertTypedAddress(add);
+   DgVertex2DDCoord vert = q2ddToVertex_->convertTypedAddress(q2dd);
+   DgProjTriCoord tri = vertexToProjTri_->convertTypedAddress(vert);
+
+   return projInv_->convertTypedAddress(tri);
+
+} // DgGeoCoord DgIDGGBase::invQuantify
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DDCoord
+DgIDGGBase::toQ2DD (const DgQ2DICoord& add) const
+{
+   return q2diToQ2DD_->convertTypedAddress(add);
+
+} // DgQ2DDCoord DgIDGGBase::toQ2DD
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgIDGGBase::fromQ2DD (const DgQ2DDCoord& pt) const
+{
+   return q2ddToQ2DI_->convertTypedAddress(pt);
+
+} // DgQ2DICoord DgIDGGBase::fromQ2DD
+
+////////////////////////////////////////////////////////////////////////////////
+template<class T> static void
+quantifyPoints (const DgIDGGBase& dgg, const T* lon, const T* lat, size_t n,
+                DgQ2DICoord* out, bool rads)
+{
+   // degrees are converted exactly as by the geoRF degree converter
+   const size_t blockSize = 256;
+   DgGeoCoord pts[blockSize];
+   for (size_t k0 = 0; k0 < n; k0 += blockSize) {
+      const size_t m = (n - k0 < blockSize) ? n - k0 : blockSize;
+      for (size_t k = 0; k < m; k++)
+         pts[k] = DgGeoCoord((long double) lon[k0 + k],
+                             (long double) lat[k0 + k], rads);
+
+      dgg.quantifyBatch(pts, m, out + k0);
+   }
+
+} // static void quantifyPoints
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGBase::quantifyBatch (const double* lon, const double* lat, size_t n,
+                           DgQ2DICoord* out, bool rads) const
+{
+   quantifyPoints(*this, lon, lat, n, out, rads);
+
+} // void DgIDGGBase::quantifyBatch
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGBase::quantifyBatch (const long double* lon, const long double* lat,
+                           size_t n, DgQ2DICoord* out, bool rads) const
+{
+   quantifyPoints(*this, lon, lat, n, out, rads);
+
+} // void DgIDGGBase::quantifyBatch
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGBase::quantifyBatch (const DgGeoCoord* pts, size_t n,
+                           DgQ2DICoord* out) const
+{
+   const size_t blockSize = 256;
+   DgProjTriCoord tris[blockSize];
+   for (size_t k0 = 0; k0 < n; k0 += blockSize) {
+      const size_t m = (n - k0 < blockSize) ? n - k0 : blockSize;
+      projFwd_->convertBatch(pts + k0, tris, m);
+
+      for (size_t k = 0; k < m; k++) {
+         DgVertex2DDCoord vert = projTriToVertex_->convertTypedAddress(tris[k]);
+         DgQ2DDCoord q2dd = vertexToQ2DD_->convertTypedAddress(vert);
+         out[k0 + k] = q2ddToQ2DI_->convertTypedAddress(q2dd);
+      }
+   }
+
+} // void DgIDGGBase::quantifyBatch
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgIDGGBase::setVertices (const DgLocation& loc, DgPolygon& vec,
                      int densify) const
+{
+   setVertices(loc, vec, densify, nullptr);
+
+} // void DgIDGGBase::setVertices
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGBase::setVertices (const DgLocation& loc, DgPolygon& vec,
+                     int densify, DgVertexCache* cache) const
 {
    vec.clearAddress();
    backFrame().convert(vec);
@@ -343,14 +465,23 @@ DgIDGGBase::setVertices (const DgLocation& loc, DgPolygon& vec,
    convert(&tLoc);
 //cout << "**** " << tLoc << std::endl;
 
-   setAddVertices(*getAddress(tLoc), vec, densify);
+   setAddVertices(*getAddress(tLoc), vec, densify, cache);
 
-} // void DgDiscRF::setVertices
+} // void DgIDGGBase::setVertices
 
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgIDGGBase::setAddVertices (const DgQ2DICoord& add, DgPolygon& vec,
                         int densify) const
+{
+   setAddVertices(add, vec, densify, nullptr);
+
+} // void DgIDGGBase::setAddVertices
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGBase::setAddVertices (const DgQ2DICoord& add, DgPolygon& vec,
+                        int densify, DgVertexCache* cache) const
 {
    DgLocation* tmpLoc = grid2D().makeLocation(add.coord());
 //cout << "a: " << *tmpLoc << std::endl;
@@ -369,53 +500,49 @@ DgIDGGBase::setAddVertices (const DgQ2DICoord& add, DgPolygon& vec,
 
    // kludge to jump nets and add the quad number
 
-   DgPolygon tmpVec(q2ddRF());
-   std::vector<DgAddressBase*>& v = tmpVec.addressVec();
+   // add the quad number and convert each vertex through vertexRF to the
+   // geoRF using the typed converters directly; points shared with
+   // recently generated cells are taken from the cache
+
+   if (cache) cache->setDgg(*this);
+
+   const bool clipNonKeepers = !isCongruent() && add.coord() == DgIVec2D(0, 0);
+   std::vector<DgAddressBase*> geoV;
+   geoV.reserve(vec.size());
    for (int i = 0; i < vec.size(); i++)
    {
-      v.push_back(new DgAddress<DgQ2DDCoord>(DgQ2DDCoord(add.quadNum(),
-                       *(ccFrame().getAddress(vec[i])))));
-   }
-   vec = tmpVec;
-
-//cout << "D: " << vec << std::endl;
+      const DgDVec2D& pt = *(ccFrame().getAddress(vec[i]));
+
+      const DgVertexCache::DgVertexVal* cached =
+                     (cache) ? cache->find(add.quadNum(), pt) : nullptr;
+      DgVertexCache::DgVertexVal val;
+      if (cached)
+         val = *cached;
+      else
+      {
+         DgQ2DDCoord q2dd(add.quadNum(), pt);
+         DgVertex2DDCoord vert = q2ddToVertex_->convertTypedAddress(q2dd);
+         val.keep = vert.keep();
 
-   vertexRF().convert(vec);
+         DgProjTriCoord tri = vertexToProjTri_->convertTypedAddress(vert);
+         val.geo = projInv_->convertTypedAddress(tri);
 
-//cout << "E: " << vec << std::endl;
+         if (cache) cache->insert(add.quadNum(), pt, val);
+      }
 
-   if (!isCongruent() && add.coord() == DgIVec2D(0, 0))
-   {
       // we need to explicitly go to vertexRF to look for non-keepers
       // to clip
-      std::vector<DgAddressBase*>& v = vec.addressVec();
-      std::vector<DgAddressBase*> newV;
-      for (unsigned long i = 0; i < v.size(); i++) {
-         DgAddress<DgVertex2DDCoord>* fullAdd =
-                   dynamic_cast< DgAddress<DgVertex2DDCoord>* >(v[i]);
-         DgVertex2DDCoord& add = fullAdd->address();
-         if (add.keep()) {
-            newV.push_back(v[i]);
-         } else {
-            delete v[i];
-         }
-      }
+      if (clipNonKeepers && !val.keep)
+         continue;
 
-      v.resize(0);
-      for (unsigned long i = 0; i < newV.size(); i++) {
-         v.push_back(newV[i]);
-      }
+      geoV.push_back(new DgAddress<DgGeoCoord>(val.geo));
    }
 
-   // now convert to the geoRF
+   vec = DgPolygon(geoRF()); // force empty RF to allow for network change
+   vec.addressVec().swap(geoV);
 
-//cout << "F: " << vec << std::endl;
-   geoRF().convert(&vec);
 //cout << "G: " << vec << std::endl;
 
-   // Release the Kraken... I mean, the vector's pointers:
-   dgg::util::release(v);
-
 } // DgIDGGBase::setAddVertices
 
 ////////////////////////////////////////////////////////////////////////////////
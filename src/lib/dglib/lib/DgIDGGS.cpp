@@ -130,5 +130,24 @@ const std::string& hierNdxSysType = "NONE");
 
 } // DgIDGGS::DgIDGGS
 
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGS::makeGrid (int res) const
+{
+   DgIDGGBase* dgg = makeIDGG(res);
+   gridsMutable()[res] = dgg;
+
+   // the converters are owned by the network
+   Dg2WayTopoResAddConverter<DgQ2DICoord, DgGeoCoord, long double>(*this, *dgg, res);
+
+   for (int s = 0; s < nRes(); s++) {
+      if (s != res && gridsMutable()[s]) {
+         new DgIDGGResConverter(*dgg, idggBase(s));
+         new DgIDGGResConverter(idggBase(s), *dgg);
+      }
+   }
+
+} // void DgIDGGS::makeGrid
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
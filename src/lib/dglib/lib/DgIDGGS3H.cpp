@@ -64,13 +64,13 @@ DgIDGGS3H::setAddParents (const DgResAdd<DgQ2DICoord>& add,
                              DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
    topoRF(add.res()).setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // vertices lie in parents
 
-   grids()[add.res() - 1]->convert(verts);
+   grid(add.res() - 1)->convert(verts);
 
    for (int i = 0; i < verts.size(); i++)
    {
@@ -97,8 +97,8 @@ DgIDGGS3H::setAddInteriorChildren (const DgResAdd<DgQ2DICoord>& add,
                                         DgLocVector& vec) const
 {
    DgLocVector verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res() + 1]->convert(tmpLoc);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res() + 1)->convert(tmpLoc);
    vec.push_back(*tmpLoc);
 
    delete tmpLoc;
@@ -111,13 +111,13 @@ DgIDGGS3H::setAddBoundaryChildren (const DgResAdd<DgQ2DICoord>& add,
                                         DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
    topoRF(add.res()).setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // vertices lie in children
 
-   grids()[add.res() + 1]->convert(verts);
+   grid(add.res() + 1)->convert(verts);
 
    for (int i = 0; i < verts.size(); i++)
    {
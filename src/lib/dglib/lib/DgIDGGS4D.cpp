@@ -42,27 +42,23 @@ DgIDGGS4D::DgIDGGS4D (DgRFNetwork& network, const DgGeoSphRF& backFrame,
         : DgIDGGS (network, backFrame, vert0, azDegs, 4, nRes,
                        Diamond, gridMetric, name, projType)
 {
-   const int aperture = 4;
-
    setUndefLoc(makeLocation(undefAddress()));
    isAligned_ = true;
    isCongruent_ = true;
 
-   // create the DGGs
-
-   (*grids_)[0] = new DgDmdIDGG(*this, aperture, 0, name + dgg::util::to_string(0, 2), gridMetric);
-   //cout << "========================\nRES 0: " << dmdIdgg(0);
+   // the DGGs are created on first access by makeIDGG
+   setLazyGrids();
 
-   for (int r = 1; r < nRes; r++)
-   {
-      (*grids_)[r] = new DgDmdIDGG(*this, aperture, r, name + dgg::util::to_string(r, 2), gridMetric);
-   //cout << "========================\nRES " << r << ": " << dmdIdgg(r);
-   }
+} // DgDmdIDGGS::DgDmdIDGGS
 
-   for (int r = 0; r < nRes; r++)
-       Dg2WayTopoResAddConverter<DgQ2DICoord, DgGeoCoord, long double>(*this, *(grids()[r]), r);
+////////////////////////////////////////////////////////////////////////////////
+DgIDGGBase*
+DgIDGGS4D::makeIDGG (int res) const
+{
+   return new DgDmdIDGG(*this, aperture(), res,
+                        name() + dgg::util::to_string(res, 2), gridMetric());
 
-} // DgDmdIDGGS::DgDmdIDGGS
+} // DgIDGGBase* DgIDGGS4D::makeIDGG
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -97,7 +93,7 @@ DgIDGGS4D::setAddParents (const DgResAdd<DgQ2DICoord>& add,
 //cout << "   setAddParents: " << add << std::endl;
    //if (isCongruent()) {
       DgLocation* tmpLoc = makeLocation(add);
-      grids()[add.res() - 1]->convert(tmpLoc);
+      grid(add.res() - 1)->convert(tmpLoc);
       convert(tmpLoc);
 
       vec.push_back(*tmpLoc);
@@ -115,7 +111,7 @@ DgIDGGS4D::setAddParents (const DgResAdd<DgQ2DICoord>& add,
 
 //cout << "   verts 1: " << *verts << std::endl;
 
-      grids()[add.res() - 1]->convert(*verts);
+      grid(add.res() - 1)->convert(*verts);
 //cout << "   verts 2: " << *verts << std::endl;
       convert(*verts);
 //cout << "   verts 3: " << *verts << std::endl;
@@ -173,7 +169,7 @@ DgIDGGS4D::setAddInteriorChildren (const DgResAdd<DgQ2DICoord>& add,
       // only center square is interior
 
       DgLocation* tmpLoc = makeLocation(add);
-      grids()[add.res() + 1]->convert(tmpLoc);
+      grid(add.res() + 1)->convert(tmpLoc);
       vec.push_back(*tmpLoc);
 
       delete tmpLoc;
@@ -197,12 +193,12 @@ DgIDGGS4D::setAddBoundaryChildren (const DgResAdd<DgQ2DICoord>& /* add */,
 
       // D8 neighbors is what we want
 
-      DgDmdD8Grid2D d8(network(), grids()[add.res() + 1]->backFrame(),
+      DgDmdD8Grid2D d8(network(), grid(add.res() + 1)->backFrame(),
                        "dummyD8");
       d8.convert(tmpLoc);
       d8.setNeighbors(*tmpLoc, vec);
 
-      grids()[add.res() + 1]->convert(vec);
+      grid(add.res() + 1)->convert(vec);
       convert(vec);
 
       delete tmpLoc;
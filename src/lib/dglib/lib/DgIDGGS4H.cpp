@@ -64,8 +64,8 @@ DgIDGGS4H::setAddParents (const DgResAdd<DgQ2DICoord>& add,
                              DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res()]->setVertices(*tmpLoc, verts);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res())->setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // edge midpoints lie in parents
@@ -73,13 +73,13 @@ DgIDGGS4H::setAddParents (const DgResAdd<DgQ2DICoord>& add,
    DgLocVector midPts(verts.rf());
    for (int i = 0; i < verts.size(); i++)
    {
-      DgDVec2D pt1 = *(grids()[add.res()]->backFrame().getAddress(verts[i]));
+      DgDVec2D pt1 = *(grid(add.res())->backFrame().getAddress(verts[i]));
 
-      DgDVec2D pt2 = *(grids()[add.res()]->backFrame().getAddress(
+      DgDVec2D pt2 = *(grid(add.res())->backFrame().getAddress(
                                            verts[(i + 1) % verts.size()]));
 
       DgLocation* tmpLoc =
-         grids()[add.res()]->backFrame().makeLocation(
+         grid(add.res())->backFrame().makeLocation(
                                            DgDVec2D::midPoint(pt1, pt2));
 
       midPts.push_back(*tmpLoc);
@@ -87,7 +87,7 @@ DgIDGGS4H::setAddParents (const DgResAdd<DgQ2DICoord>& add,
       delete tmpLoc;
    }
 
-   grids()[add.res() - 1]->convert(midPts);
+   grid(add.res() - 1)->convert(midPts);
 
    for (int i = 0; i < midPts.size(); i++)
    {
@@ -114,8 +114,8 @@ DgIDGGS4H::setAddInteriorChildren (const DgResAdd<DgQ2DICoord>& add,
                                         DgLocVector& vec) const
 {
    DgLocVector verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res() + 1]->convert(tmpLoc);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res() + 1)->convert(tmpLoc);
    vec.push_back(*tmpLoc);
 
    delete tmpLoc;
@@ -128,8 +128,8 @@ DgIDGGS4H::setAddBoundaryChildren (const DgResAdd<DgQ2DICoord>& add,
                                         DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res()]->setVertices(*tmpLoc, verts);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res())->setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // edge midpoints lie in children
@@ -137,12 +137,12 @@ DgIDGGS4H::setAddBoundaryChildren (const DgResAdd<DgQ2DICoord>& add,
    DgLocVector midPts(verts.rf());
    for (int i = 0; i < verts.size(); i++)
    {
-      DgDVec2D pt1 = *(grids()[add.res()]->backFrame().getAddress(verts[i]));
+      DgDVec2D pt1 = *(grid(add.res())->backFrame().getAddress(verts[i]));
 
-      DgDVec2D pt2 = *(grids()[add.res()]->backFrame().getAddress(
+      DgDVec2D pt2 = *(grid(add.res())->backFrame().getAddress(
                                            verts[(i + 1) % verts.size()]));
       DgLocation* tmpLoc =
-         grids()[add.res()]->backFrame().makeLocation(
+         grid(add.res())->backFrame().makeLocation(
                                               DgDVec2D::midPoint(pt1, pt2));
 
       midPts.push_back(*tmpLoc);
@@ -150,7 +150,7 @@ DgIDGGS4H::setAddBoundaryChildren (const DgResAdd<DgQ2DICoord>& add,
       delete tmpLoc;
    }
 
-   grids()[add.res() + 1]->convert(midPts);
+   grid(add.res() + 1)->convert(midPts);
 
    for (int i = 0; i < midPts.size(); i++)
    {
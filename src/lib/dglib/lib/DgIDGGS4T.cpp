@@ -41,27 +41,23 @@ DgIDGGS4T::DgIDGGS4T (DgRFNetwork& network, const DgGeoSphRF& backFrame,
         : DgIDGGS (network, backFrame, vert0, azDegs, 4, nRes,
                        Triangle, D3, name, projType)
 {
-   const int aperture = 4;
-
    setUndefLoc(makeLocation(undefAddress()));
    isAligned_ = true;
    isCongruent_ = true;
 
-   // create the DGGs
-
-   (*grids_)[0] = new DgTriIDGG(*this, aperture, 0, name + dgg::util::to_string(0, 2));
-   //cout << "========================\nRES 0: " << triIdgg(0);
+   // the DGGs are created on first access by makeIDGG
+   setLazyGrids();
 
-   for (int r = 1; r < nRes; r++)
-   {
-      (*grids_)[r] = new DgTriIDGG(*this, aperture, r, name + dgg::util::to_string(r, 2));
-   //cout << "========================\nRES " << r << ": " << triIdgg(r);
-   }
+} // DgTriIDGGS::DgTriIDGGS
 
-   for (int r = 0; r < nRes; r++)
-       Dg2WayTopoResAddConverter<DgQ2DICoord, DgGeoCoord, long double>(*this, *(grids()[r]), r);
+////////////////////////////////////////////////////////////////////////////////
+DgIDGGBase*
+DgIDGGS4T::makeIDGG (int res) const
+{
+   return new DgTriIDGG(*this, aperture(), res,
+                        name() + dgg::util::to_string(res, 2));
 
-} // DgTriIDGGS::DgTriIDGGS
+} // DgIDGGBase* DgIDGGS4T::makeIDGG
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -96,7 +92,7 @@ DgIDGGS4T::setAddParents (const DgResAdd<DgQ2DICoord>& add,
 //cout << "   setAddParents: " << add << std::endl;
    if (isCongruent()) {
       DgLocation* tmpLoc = makeLocation(add);
-      grids()[add.res() - 1]->convert(tmpLoc);
+      grid(add.res() - 1)->convert(tmpLoc);
       convert(tmpLoc);
 
       vec.push_back(*tmpLoc);
@@ -61,13 +61,13 @@ DgIDGGS7H::setAddParents (const DgResAdd<DgQ2DICoord>& add,
                              DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res()]->setVertices(*tmpLoc, verts);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res())->setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // vertices lie in parents
 
-   grids()[add.res() - 1]->convert(verts);
+   grid(add.res() - 1)->convert(verts);
 
    for (int i = 0; i < verts.size(); i++)
    {
@@ -94,8 +94,8 @@ DgIDGGS7H::setAddInteriorChildren (const DgResAdd<DgQ2DICoord>& add,
                                         DgLocVector& vec) const
 {
    DgLocVector verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res() + 1]->convert(tmpLoc);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res() + 1)->convert(tmpLoc);
    vec.push_back(*tmpLoc);
 
    delete tmpLoc;
@@ -108,13 +108,13 @@ DgIDGGS7H::setAddBoundaryChildren (const DgResAdd<DgQ2DICoord>& add,
                                         DgLocVector& vec) const
 {
    DgPolygon verts;
-   DgLocation* tmpLoc = grids()[add.res()]->makeLocation(add.address());
-   grids()[add.res()]->setVertices(*tmpLoc, verts);
+   DgLocation* tmpLoc = grid(add.res())->makeLocation(add.address());
+   grid(add.res())->setVertices(*tmpLoc, verts);
    delete tmpLoc;
 
    // vertices lie in children
 
-   grids()[add.res() + 1]->convert(verts);
+   grid(add.res() + 1)->convert(verts);
 
    for (int i = 0; i < verts.size(); i++)
    {
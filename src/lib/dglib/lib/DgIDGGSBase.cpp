@@ -54,3 +54,14 @@ DgIDGGSBase::makeRF (DgRFNetwork& network, const DgGeoSphRF& backFrame,
 } // DgIDGGSBase::makeRF
 
 ////////////////////////////////////////////////////////////////////////////////
+void
+DgIDGGSBase::freeze (void) const
+{
+   // grids are otherwise created on first access
+   grids();
+
+   network().freeze();
+
+} // void DgIDGGSBase::freeze
+
+////////////////////////////////////////////////////////////////////////////////
@@ -210,11 +210,12 @@ DgQ2DDRF::str2add (DgQ2DDCoord* add, const char* str, char delimiter) const
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
 
    // get the quadNum
 
-   char* tok = strtok(tmpStr, delimStr);
+   char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    int q = -1;
    if (!tok || sscanf(tok, "%d", &q) != 1)
    {
@@ -243,11 +244,12 @@ DgVertex2DDRF::str2add (DgVertex2DDCoord* add, const char* str, char delimiter)
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
 
    // get the vertNum
 
-   char* tok = strtok(tmpStr, delimStr);
+   char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    int vNum = -1;
    if (!tok || sscanf(tok, "%d", &vNum) != 1)
    {
@@ -257,7 +259,7 @@ DgVertex2DDRF::str2add (DgVertex2DDCoord* add, const char* str, char delimiter)
 
    // get the triNum
 
-   tok = strtok(NULL, delimStr);
+   tok = dgg::util::nextToken(NULL, delimStr, &tokPos);
    int tNum = -1;
    if (!tok || sscanf(tok, "%d", &tNum) != 1)
    {
@@ -267,7 +269,7 @@ DgVertex2DDRF::str2add (DgVertex2DDCoord* add, const char* str, char delimiter)
 
    // get the keeper
 
-   tok = strtok(NULL, delimStr);
+   tok = dgg::util::nextToken(NULL, delimStr, &tokPos);
 
    bool keep = true;;
 
@@ -291,11 +293,29 @@ DgVertex2DDRF::str2add (DgVertex2DDCoord* add, const char* str, char delimiter)
 
 } // const char* DgVertex2DDRF::str2add
 
+////////////////////////////////////////////////////////////////////////////////
+DgIDGGResConverter::DgIDGGResConverter (const DgIDGGBase& from,
+                                        const DgIDGGBase& to)
+  : DgConverter<DgQ2DICoord, long long int, DgQ2DICoord, long long int>(from, to),
+    fromIDGG_ (from), toIDGG_ (to)
+{
+} // DgIDGGResConverter::DgIDGGResConverter
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgIDGGResConverter::convertTypedAddress (const DgQ2DICoord& addIn) const
+{
+   // Q2DD coordinates are independent of resolution; the target grid
+   // handles any quad edge overage
+   return toIDGG_.fromQ2DD(fromIDGG_.toQ2DD(addIn));
+
+} // DgQ2DICoord DgIDGGResConverter::convertTypedAddress
+
 ////////////////////////////////////////////////////////////////////////////////
 DgQ2DDtoIConverter::DgQ2DDtoIConverter (
    const DgRF<DgQ2DDCoord, long double>& from, const DgRF<DgQ2DICoord, long long int>& to)
   : DgConverter<DgQ2DDCoord, long double, DgQ2DICoord, long long int>(from, to),
-    pIDGG_ (0)
+    pIDGG_ (0), ccToGrid_ (0)
 {
    pIDGG_ = dynamic_cast<const DgIDGGBase*>(&toFrame());
 
@@ -305,28 +325,39 @@ DgQ2DDtoIConverter::DgQ2DDtoIConverter (
       " toFrame not of type DgIDGGBase", DgBase::Fatal);
    }
 
+   const DgRFBase& cc = IDGG().ccFrame();
+   const DgRFBase& bf = IDGG().grid2D().backFrame();
+   if (cc != bf)
+      ccToGrid_ = dynamic_cast<const DgConverter<DgDVec2D, long double,
+                      DgDVec2D, long double>*>(cc.network().getConverter(cc, bf));
+
 } // DgQ2DDtoIConverter::DgQ2DDtoIConverter
 
 ////////////////////////////////////////////////////////////////////////////////
-DgQ2DICoord
-DgQ2DDtoIConverter::convertTypedAddress (const DgQ2DDCoord& addIn) const
+DgIVec2D
+DgQ2DDtoIConverter::quantifyCC (const DgDVec2D& pt) const
 {
-   DgLocation* loc = IDGG().ccFrame().makeLocation(addIn.coord());
+   if (ccToGrid_)
+      return IDGG().grid2D().quantify(ccToGrid_->convertTypedAddress(pt));
 
-#if DGDEBUG
-dgcout << "\nDgQ2DDtoIConverter::convertTypedAddress loc: " << *loc << std::endl;
-#endif
+   DgLocation* loc = IDGG().ccFrame().makeLocation(pt);
+   IDGG().grid2D().convert(loc);
+   DgIVec2D coord = *IDGG().grid2D().getAddress(*loc);
+   delete loc;
 
-    IDGG().grid2D().convert(loc);
+   return coord;
 
-//dgcout << "XX " << addIn << " " << *loc << std::endl;
+} // DgIVec2D DgQ2DDtoIConverter::quantifyCC
 
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgQ2DDtoIConverter::convertTypedAddress (const DgQ2DDCoord& addIn) const
+{
 #if DGDEBUG
-dgcout << " ---> A. " << *loc << std::endl;
+dgcout << "\nDgQ2DDtoIConverter::convertTypedAddress addIn: " << addIn << std::endl;
 #endif
 
-   DgIVec2D coord = *IDGG().grid2D().getAddress(*loc);
-   delete loc;
+   DgIVec2D coord = quantifyCC(addIn.coord());
 
    int quadNum = addIn.quadNum();
 
@@ -386,10 +417,7 @@ dgcout << " ---> B. " << coord << std::endl;
 
    if (overage) {
       // nudge the incoming point and try again
-      loc = IDGG().ccFrame().makeLocation(tmp);
-      IDGG().grid2D().convert(loc);
-      coord = *IDGG().grid2D().getAddress(*loc);
-      delete loc;
+      coord = quantifyCC(tmp);
 
       // reset the overage conditions
       underI = coord.i() < minBottomI;
@@ -520,7 +548,7 @@ dgcout << " ---> D. " << coord << std::endl;
 DgQ2DItoDConverter::DgQ2DItoDConverter (const DgRF<DgQ2DICoord, long long int>& from,
                                         const DgRF<DgQ2DDCoord, long double>& to)
         : DgConverter<DgQ2DICoord, long long int, DgQ2DDCoord, long double> (from, to),
-          pIDGG_ (NULL)
+          pIDGG_ (NULL), gridToCC_ (NULL)
 {
    pIDGG_ = dynamic_cast<const DgIDGGBase*>(&fromFrame());
 
@@ -530,16 +558,28 @@ DgQ2DItoDConverter::DgQ2DItoDConverter (const DgRF<DgQ2DICoord, long long int>&
          " fromFrame not of type DgIDGGBase", DgBase::Fatal);
    }
 
+   const DgRFBase& bf = IDGG().grid2D().backFrame();
+   const DgRFBase& cc = IDGG().ccFrame();
+   if (bf != cc)
+      gridToCC_ = dynamic_cast<const DgConverter<DgDVec2D, long double,
+                      DgDVec2D, long double>*>(bf.network().getConverter(bf, cc));
+
 } // DgQ2DItoDConverter::DgQ2DItoDConverter
 
 ////////////////////////////////////////////////////////////////////////////////
 DgQ2DDCoord
 DgQ2DItoDConverter::convertTypedAddress (const DgQ2DICoord& addIn) const
 {
-   DgLocation* loc = IDGG().grid2D().makeLocation(addIn.coord());
-    IDGG().ccFrame().convert(loc);
-    DgDVec2D coord = *IDGG().ccFrame().getAddress(*loc);
-   delete loc;
+   DgDVec2D coord;
+   if (gridToCC_)
+      coord = gridToCC_->convertTypedAddress(
+                       IDGG().grid2D().invQuantify(addIn.coord()));
+   else {
+      DgLocation* loc = IDGG().grid2D().makeLocation(addIn.coord());
+      IDGG().ccFrame().convert(loc);
+      coord = *IDGG().ccFrame().getAddress(*loc);
+      delete loc;
+   }
 
    DgQ2DDCoord result(addIn.quadNum(), coord);
 
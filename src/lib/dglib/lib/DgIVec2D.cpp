@@ -41,20 +41,21 @@ DgIVec2D::fromString (const char* str, char delimiter)
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
 
    // Get i and j:
-   char* tok;
+   char* tok = 0;
 
    long long int	iIn(0),
 	   		jIn(0);
 
    try
     {
-   	tok = strtok(tmpStr, delimStr);
+   	tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    	iIn = dgg::util::from_string<long long int>(tok);
 	
-   	tok = strtok(NULL, delimStr);
+   	tok = dgg::util::nextToken(NULL, delimStr, &tokPos);
    	jIn = dgg::util::from_string<long long int>(tok);
     }
    catch(...)
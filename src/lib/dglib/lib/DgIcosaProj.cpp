@@ -0,0 +1,85 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgIcosaProj.cpp: DgIcosaProjFwd class implementation
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <dglib/DgIcosaProj.h>
+
+////////////////////////////////////////////////////////////////////////////////
+DgIcosaProjFwd::DgIcosaProjFwd (const DgRF<DgGeoCoord, long double>& from,
+                                const DgRF<DgProjTriCoord, long double>& to)
+   : DgConverter<DgGeoCoord, long double, DgProjTriCoord, long double>(from, to),
+     pProjTriRF_ (0)
+{
+   pProjTriRF_ = dynamic_cast<const DgProjTriRF*>(&toFrame());
+
+   if (!pProjTriRF_)
+   {
+      report("DgIcosaProjFwd::DgIcosaProjFwd(): "
+        " toFrame not of type DgProjTriRF", DgBase::Fatal);
+   }
+
+} // DgIcosaProjFwd::DgIcosaProjFwd
+
+////////////////////////////////////////////////////////////////////////////////
+DgProjTriCoord
+DgIcosaProjFwd::convertTypedAddress (const DgGeoCoord& addIn) const
+{
+   GeoCoord ll;
+   ll.lon = addIn.lon();
+   ll.lat = addIn.lat();
+
+   return projectOnTri(addIn, projTriRF().sphIcosa().whichIcosaTri(ll));
+
+} // DgProjTriCoord DgIcosaProjFwd::convertTypedAddress
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgIcosaProjFwd::convertBatch (const DgGeoCoord* pts, DgProjTriCoord* out,
+                              size_t n) const
+{
+   const DgSphIcosa& sphIcosa = projTriRF().sphIcosa();
+
+   const size_t blockSize = 256;
+   GeoCoord ll[blockSize];
+   int tris[blockSize];
+
+   for (size_t k0 = 0; k0 < n; k0 += blockSize)
+   {
+      const size_t m = (n - k0 < blockSize) ? n - k0 : blockSize;
+
+      for (size_t k = 0; k < m; k++)
+      {
+         ll[k].lon = pts[k0 + k].lon();
+         ll[k].lat = pts[k0 + k].lat();
+      }
+
+      sphIcosa.whichIcosaTri(ll, tris, m);
+
+      for (size_t k = 0; k < m; k++)
+         out[k0 + k] = projectOnTri(pts[k0 + k], tris[k]);
+   }
+
+} // void DgIcosaProjFwd::convertBatch
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
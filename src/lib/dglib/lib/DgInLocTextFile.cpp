@@ -34,13 +34,23 @@
 #include <dglib/DgDataList.h>
 #include <dglib/DgDataField.h>
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 DgInLocTextFile::DgInLocTextFile (const DgRFBase& rfIn, const std::string* fileNameIn,
                               DgReportLevel failLevel)
     : DgInLocStreamFile (rfIn, fileNameIn, false, failLevel),
-      forcePolyLine_ (false), forceCells_ (false)
+      forcePolyLine_ (false), forceCells_ (false),
+      mapData_ (nullptr), mapSize_ (0), mapPos_ (0)
 {
    // create lat/lon rf (may be NULL)
    degRF_ = dynamic_cast<const DgGeoSphDegRF*>(&rfIn);
@@ -50,9 +60,120 @@ DgInLocTextFile::DgInLocTextFile (const DgRFBase& rfIn, const std::string* fileN
 ////////////////////////////////////////////////////////////////////////////////
 DgInLocTextFile::~DgInLocTextFile (void)
 {
+   close();
 
 } // DgInLocTextFile::~DgInLocTextFile
 
+////////////////////////////////////////////////////////////////////////////////
+bool
+DgInLocTextFile::mapFile (void)
+{
+#ifdef _WIN32
+   return false;
+#else
+   if (mapData_) return true;
+
+   int fd = ::open(fileName().c_str(), O_RDONLY);
+   if (fd < 0) return false;
+
+   struct stat st;
+   if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+      ::close(fd);
+      return false;
+   }
+
+   void* data = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   ::close(fd);  // the mapping remains valid
+   if (data == MAP_FAILED) return false;
+
+   madvise(data, (size_t) st.st_size, MADV_SEQUENTIAL);
+
+   mapData_ = static_cast<const char*>(data);
+   mapSize_ = (unsigned long long int) st.st_size;
+   mapPos_ = 0;
+
+   return true;
+#endif
+
+} // bool DgInLocTextFile::mapFile
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgInLocTextFile::close (void)
+{
+#ifndef _WIN32
+   if (mapData_) {
+      munmap(const_cast<char*>(mapData_), (size_t) mapSize_);
+      mapData_ = nullptr;
+      mapSize_ = mapPos_ = 0;
+   }
+#endif
+
+   DgInLocStreamFile::close();
+
+} // void DgInLocTextFile::close
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+DgInLocTextFile::nextLine (const char*& pos, const char* blockEnd,
+                           const char*& begin, const char*& end)
+{
+   if (pos >= blockEnd) return false;
+
+   begin = pos;
+   end = static_cast<const char*>(memchr(pos, '\n', blockEnd - pos));
+   if (end) {
+      pos = end + 1;
+   } else {
+      // the last line of the file need not be terminated
+      end = blockEnd;
+      pos = blockEnd;
+   }
+
+   return true;
+
+} // bool DgInLocTextFile::nextLine
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+DgInLocTextFile::nextLine (const char*& begin, const char*& end)
+{
+   if (!mapData_) return false;
+
+   const char* pos = mapData_ + mapPos_;
+   bool found = nextLine(pos, mapData_ + mapSize_, begin, end);
+   mapPos_ = pos - mapData_;
+
+   return found;
+
+} // bool DgInLocTextFile::nextLine
+
+////////////////////////////////////////////////////////////////////////////////
+bool
+DgInLocTextFile::nextBlock (unsigned long long int maxBytes,
+                            const char*& begin, const char*& end)
+{
+   if (!mapData_ || mapPos_ >= mapSize_) return false;
+
+   begin = mapData_ + mapPos_;
+   const char* fileEnd = mapData_ + mapSize_;
+
+   // extend the block to the end of the line containing its last byte
+   unsigned long long int nBytes = std::max(maxBytes, 1ULL);
+   if (nBytes >= mapSize_ - mapPos_) {
+      end = fileEnd;
+   } else {
+      const char* last = begin + nBytes - 1;
+      end = static_cast<const char*>(memchr(last, '\n', fileEnd - last));
+      end = (end) ? end + 1 : fileEnd;
+   }
+
+   mapPos_ = end - mapData_;
+
+   return true;
+
+} // bool DgInLocTextFile::nextBlock
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 DgInLocFile&
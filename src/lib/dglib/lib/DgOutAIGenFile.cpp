@@ -59,12 +59,7 @@ DgOutAIGenFile::insert (const DgDVec2D& pt)
 //
 ////////////////////////////////////////////////////////////////////////////////
 {
-   const int maxBuffSize = 200;
-   char buff[maxBuffSize];
-
-   snprintf(buff, maxBuffSize, formatStr(), pt.x(), pt.y());
-
-   *this << buff;
+   writePoint(pt.x(), pt.y());
 
    return *this;
 
@@ -125,7 +120,7 @@ DgOutAIGenFile::insert (DgLocVector& vec, const std::string* label,
    for (unsigned long i = 0; i < v.size(); i++)
       this->insert(rf().getVecAddress(*v[i]));
 
-   *this << "END" << std::endl;
+   *this << "END" << "\n";
 
    return *this;
 
@@ -166,7 +161,7 @@ DgOutAIGenFile::insert (DgPolygon& poly, const std::string* label,
    // rewrite the first vertex
    this->insert(rf().getVecAddress(*v[v.size() - 1]));
 
-   *this << "END" << std::endl;
+   *this << "END" << "\n";
 
    return *this;
 
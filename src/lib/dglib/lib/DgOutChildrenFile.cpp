@@ -63,12 +63,15 @@ DgOutChildrenFile::insert (const DgLocation& center, DgLocVector& vec)
       DgLocation tmpLoc(center);
       outRF_->convert(&tmpLoc);
       *this << tmpLoc.asString(' ');
+      // go through the child grid so the multi-resolution addresses don't
+      // take a round trip through the sphere
+      chdDgg_.convert(&vec);
       chdOutRF_->convert(&vec);
       for (int i = 0; i < vec.size(); i++)
          *this << " " << vec[i].asString(' ');
    }
 
-   *this << std::endl;
+   *this << "\n";
 
    return *this;
 
@@ -40,6 +40,8 @@
 #include <dglib/DgIDGGSBase.h>
 #include <dglib/DgBoundedIDGG.h>
 
+const unsigned long int DgOutGdalFile::defaultTransactionBatchSize = 10000;
+
 ////////////////////////////////////////////////////////////////////////////////
 DgOutGdalFile::DgOutGdalFile (const DgGeoSphDegRF& rf,
                     const std::string& filename, const std::string& gdalDriver,
@@ -47,7 +49,8 @@ DgOutGdalFile::DgOutGdalFile (const DgGeoSphDegRF& rf,
                     DgReportLevel failLevel)
     : DgOutLocFile (filename, rf, isPointFile, failLevel), _mode (mode),
          _gdalDriver(""), _driver(NULL), _dataset(NULL), _oLayer(NULL),
-         fileNameOnly_("")
+         _feature(NULL), _transactionBatchSize(defaultTransactionBatchSize),
+         _nInTransaction(0), _useTransactions(false), fileNameOnly_("")
 {
    // test for override of vecAddress
    DgAddressBase* dummy = rf.vecAddress(DgDVec2D(M_ZERO, M_ZERO));
@@ -65,6 +68,25 @@ DgOutGdalFile::~DgOutGdalFile()
    close();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void
+DgOutGdalFile::close (void)
+{
+   if (!_dataset)
+      return;
+
+   commitTransaction();
+
+   if (_feature) {
+      OGRFeature::DestroyFeature(_feature);
+      _feature = NULL;
+   }
+
+   GDALClose(_dataset);
+   _dataset = NULL;
+   _oLayer = NULL;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgOutGdalFile::init (bool outputPoint, bool outputRegion,
@@ -114,6 +136,12 @@ DgOutGdalFile::init (bool outputPoint, bool outputRegion,
    if (_oLayer == NULL)
       ::report( "Layer creation failed.", DgBase::Fatal );
 
+   // drivers that commit each feature separately by default (e.g. GPKG)
+   // are much faster writing batches of features in a single transaction
+   _useTransactions = (_transactionBatchSize > 0 &&
+                       _dataset->TestCapability(ODsCTransactions));
+   _nInTransaction = 0;
+
    // create the name field
    OGRFieldDefn *fldDfn = new OGRFieldDefn( "name", OFTString );
    fldDfn->SetWidth(32);
@@ -166,15 +194,22 @@ DgOutGdalFile::init (bool outputPoint, bool outputRegion,
 
 ////////////////////////////////////////////////////////////////////////////////
 OGRFeature*
-DgOutGdalFile::createFeature (const std::string& label) const
+DgOutGdalFile::createFeature (const std::string& label)
 {
-   OGRFeature *feature = OGRFeature::CreateFeature(_oLayer->GetLayerDefn());
-   if (!feature)
-      ::report("GDAL feature creation failed.", DgBase::Fatal );
+   // the layer's single feature is reused; clear the previous values
+   if (!_feature) {
+      _feature = OGRFeature::CreateFeature(_oLayer->GetLayerDefn());
+      if (!_feature)
+         ::report("GDAL feature creation failed.", DgBase::Fatal );
+   } else {
+      _feature->SetFID(OGRNullFID);
+      for (int i = 0; i < _feature->GetFieldCount(); i++)
+         _feature->UnsetField(i);
+   }
 
-   feature->SetField("name", label.c_str());
+   _feature->SetField("name", label.c_str());
 
-   return feature;
+   return _feature;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -275,18 +310,16 @@ DgOutGdalFile::insert (const DgIDGGBase& dgg, DgCell& cell,
    // first check for multi
    if (outputPoint && outputRegion) {
 
-      OGRGeometryCollection* collect = createCollection(cell);
-      feature->SetGeometry(collect);
+      feature->SetGeometryDirectly(createCollection(cell));
 
    } else if (outputPoint) {
 
-      OGRPoint* pt = createPoint(cell.node());
-      feature->SetGeometry(pt);
+      setPointGeometry(feature, cell.node());
 
    } else if (outputRegion) {
 
-      OGRPolygon* poly = createPolygon(cell.region());
-      feature->SetGeometry(poly);
+      setPolygonGeometry(feature, cell.region());
+
    } else
       ::report( "No geometry specified for GDAL collection feature.", DgBase::Fatal );
 
@@ -324,24 +357,47 @@ DgOutGdalFile::createPoint (const DgLocation& loc) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-OGRLinearRing*
-DgOutGdalFile::createLinearRing (const DgPolygon& poly)
+void
+DgOutGdalFile::setPointGeometry (OGRFeature* feature, const DgLocation& loc) const
 {
-   // first create a linearRing
-   OGRLinearRing *linearRing;
-   linearRing = (OGRLinearRing*) OGRGeometryFactory::createGeometry(wkbLinearRing);
+   // reuse the feature's point geometry if it has one
+   OGRPoint* oPt = dynamic_cast<OGRPoint*>(feature->GetGeometryRef());
+   if (!oPt) {
+      feature->SetGeometryDirectly(createPoint(loc));
+      return;
+   }
 
-   // fill linearRing with points
+   DgDVec2D pt = rf().getVecLocation(loc);
+   oPt->setX(pt.x());
+   oPt->setY(pt.y());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgOutGdalFile::fillLinearRing (OGRLinearRing& ring, const DgPolygon& poly)
+{
    const std::vector<DgAddressBase *>& v = poly.addressVec();
    const DgRFBase& rf = poly.rf();
-   for (std::vector<DgAddressBase *>::const_iterator i = v.begin(); v.end() != i; ++i) {
-     DgDVec2D pt = rf.getVecAddress(*(*i));
-     linearRing->addPoint(pt.x(), pt.y());
+   const int n = (int) v.size();
+
+   // the first point is repeated at the end
+   ring.setNumPoints(n + 1, FALSE);
+   for (int i = 0; i < n; i++) {
+     DgDVec2D pt = rf.getVecAddress(*v[i]);
+     ring.setPoint(i, pt.x(), pt.y());
    }
 
-   // add the first point to the end
    DgDVec2D pt = rf.getVecAddress(*v[0]);
-   linearRing->addPoint(pt.x(), pt.y());
+   ring.setPoint(n, pt.x(), pt.y());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+OGRLinearRing*
+DgOutGdalFile::createLinearRing (const DgPolygon& poly)
+{
+   OGRLinearRing *linearRing;
+   linearRing = (OGRLinearRing*) OGRGeometryFactory::createGeometry(wkbLinearRing);
+   fillLinearRing(*linearRing, poly);
 
    return linearRing;
 }
@@ -366,6 +422,20 @@ DgOutGdalFile::createPolygon (const DgPolygon& poly)
    return polygon;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void
+DgOutGdalFile::setPolygonGeometry (OGRFeature* feature,
+                                   const DgPolygon& poly) const
+{
+   // reuse the feature's polygon geometry if neither it nor poly has holes
+   OGRPolygon* polygon = dynamic_cast<OGRPolygon*>(feature->GetGeometryRef());
+   if (polygon && polygon->getExteriorRing() &&
+         polygon->getNumInteriorRings() == 0 && poly.holes().empty())
+      fillLinearRing(*polygon->getExteriorRing(), poly);
+   else
+      feature->SetGeometryDirectly(createPolygon(poly));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 OGRGeometryCollection*
 DgOutGdalFile::createCollection (const DgCell& cell) const
@@ -386,12 +456,35 @@ DgOutGdalFile::createCollection (const DgCell& cell) const
 void
 DgOutGdalFile::addFeature (OGRFeature *feature) {
 
+   // transactions only speed up writing, so if the driver refuses one
+   // write the remaining features without them
+   if (_useTransactions && _nInTransaction == 0) {
+      if (_dataset->StartTransaction() != OGRERR_NONE) {
+         ::report( "Failed to start transaction in file; writing features "
+                   "without transactions", DgBase::Warning );
+         _useTransactions = false;
+      }
+   }
+
    // make sure no errors occure with binding the feature to the layer
    if (_oLayer->CreateFeature( feature ) != OGRERR_NONE)
         ::report( "Failed to create feature in file", DgBase::Fatal );
 
-   // clean up the feature and ready for the next one
-   //OGRFeature::DestroyFeature( feature );
+   if (_useTransactions && ++_nInTransaction >= _transactionBatchSize)
+      commitTransaction();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgOutGdalFile::commitTransaction (void) {
+
+   if (_nInTransaction == 0)
+      return;
+
+   if (_dataset->CommitTransaction() != OGRERR_NONE)
+      ::report( "Failed to commit transaction in file", DgBase::Fatal );
+
+   _nInTransaction = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -413,8 +506,7 @@ DgOutGdalFile::insert (DgLocation& loc, const std::string* label,
       dataList->setFields(feature);
    }
 
-   OGRPoint* oPt = createPoint(loc);
-   feature->SetGeometry(oPt);
+   setPointGeometry(feature, loc);
 
    addFeature(feature);
 
@@ -442,8 +534,6 @@ DgOutGdalFile::insert (DgPolygon& poly, const std::string* label,
    if (!_oLayer)
       init(false, true, false, false, false, false, dataList);
 
-   OGRPolygon* polygon = createPolygon(poly);
-
    OGRFeature *feature = createFeature(*label);
 
    // set the data fields
@@ -451,7 +541,7 @@ DgOutGdalFile::insert (DgPolygon& poly, const std::string* label,
       dataList->setFields(feature);
    }
 
-   feature->SetGeometry(polygon);
+   setPolygonGeometry(feature, poly);
 
    addFeature(feature);
 
@@ -61,7 +61,6 @@ void DgOutGeoJSONFile::preamble()
    o << "{";
    o << "\"type\":\"FeatureCollection\",";
    o << "\"features\":[";
-   o.flush();
 }
 
 void DgOutGeoJSONFile::postamble()
@@ -80,15 +79,7 @@ DgOutGeoJSONFile::insert(const DgDVec2D& pt)
 {
    DgOutGeoJSONFile& o(*this);
 
-   const int maxBuffSize = 200;
-   char buff[maxBuffSize];
-
-   snprintf(buff, maxBuffSize, formatStr(), pt.x(), pt.y());
-//printf("FORMATSTR: \"%s\" buff: \"%s\"\n", formatStr(), buff);
-
-   o << buff;
-
-   o.flush();
+   o.writePoint(pt.x(), pt.y());
 
    return o;
 }
@@ -113,8 +104,6 @@ DgOutGeoJSONFile::insert (DgLocation& loc, const std::string* label,
    o.insert(rf().getVecLocation(loc));
 
    o << "}},\n";
-   o.flush();
-
    return *this;
 }
 
@@ -147,8 +136,6 @@ DgOutGeoJSONFile::insert (DgLocVector& vec, const std::string* label,
    o.insert(rf().getVecAddress(*v[0]));
 
    o << "]]}},\n";
-   o.flush();
-
    return *this;
 }
 
@@ -181,7 +168,5 @@ DgOutGeoJSONFile::insert (DgPolygon& poly, const std::string* label,
    o.insert(rf().getVecAddress(*v[0]));
 
    o << "]]}},\n";
-   o.flush();
-
    return *this;
 }
@@ -135,8 +135,6 @@ void DgOutKMLfile::preamble()
    o << "         <width>" << width_ << "</width>\n";
    o << "      </LineStyle>\n";
    o << "   </Style>\n";
-
-   o.flush();
 }
 
 void DgOutKMLfile::postamble()
@@ -152,14 +150,8 @@ DgOutKMLfile::insert(const DgDVec2D& pt)
 {
    DgOutKMLfile& o(*this);
 
-   const int maxBuffSize = 200;
-   char buff[maxBuffSize];
-
-   snprintf(buff, maxBuffSize, formatStr(), pt.x(), pt.y());
-
-   o << "            " << buff;
-
-   o.flush();
+   o << "            ";
+   o.writePoint(pt.x(), pt.y());
 
    return o;
 }
@@ -215,8 +207,6 @@ DgOutKMLfile::insert (DgLocVector& vec, const std::string* label, const DgLocati
    o << "      </LineString>\n";
    o << "</Placemark>\n";
 
-   o.flush();
-
    return *this;
 }
 
@@ -249,7 +239,5 @@ DgOutKMLfile::insert (DgPolygon& poly, const std::string* label, const DgLocatio
    o << "      </LineString>\n";
    o << "</Placemark>\n";
 
-   o.flush();
-
    return *this;
 }
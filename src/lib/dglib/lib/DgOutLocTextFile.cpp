@@ -22,6 +22,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <sstream>
+
 #include <dglib/DgOutLocTextFile.h>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -35,5 +38,42 @@ DgOutLocTextFile::DgOutLocTextFile (const std::string& fileName, const DgRFBase&
 {
 } // DgOutLocTextFile::DgOutLocTextFile
 
+////////////////////////////////////////////////////////////////////////////////
+void
+DgOutLocTextFile::setPointFormat (const std::string& prefix,
+                  const std::string& sep, const std::string& suffix)
+{
+   ptPrefix_ = prefix;
+   ptSep_ = sep;
+   ptSuffix_ = suffix;
+
+   std::ostringstream os;
+   os << prefix << "%#." << getPrecision() << "LF"
+      << sep << "%#." << getPrecision() << "LF" << suffix;
+
+   formatStr_ = os.str();
+
+} // void DgOutLocTextFile::setPointFormat
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgOutLocTextFile::writePoint (long double x, long double y)
+{
+   const int maxBuffSize = 100;
+   char xBuff[maxBuffSize];
+   char yBuff[maxBuffSize];
+
+   int nx = dgg::util::fixedToStr(xBuff, maxBuffSize, x, precision_);
+   int ny = dgg::util::fixedToStr(yBuff, maxBuffSize, y, precision_);
+
+   std::ostream& o = *this;
+   o.write(ptPrefix_.data(), ptPrefix_.size());
+   o.write(xBuff, std::min(nx, maxBuffSize - 1));
+   o.write(ptSep_.data(), ptSep_.size());
+   o.write(yBuff, std::min(ny, maxBuffSize - 1));
+   o.write(ptSuffix_.data(), ptSuffix_.size());
+
+} // void DgOutLocTextFile::writePoint
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
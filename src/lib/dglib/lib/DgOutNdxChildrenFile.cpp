@@ -61,6 +61,9 @@ DgOutNdxChildrenFile::insert (const DgLocation& center, DgLocVector& vec)
       DgLocation tmpLoc(center);
       outRF_->convert(&tmpLoc);
       *this << tmpLoc.asString(' ');
+      // go through the child grid so the multi-resolution addresses don't
+      // take a round trip through the sphere
+      chdDgg_.convert(&vec);
       ndxChdOutRF_->convert(&vec);
        for (int i = 0; i < vec.size(); i++) {
            *this << " " << vec[i].asString(' ');
@@ -68,7 +71,7 @@ DgOutNdxChildrenFile::insert (const DgLocation& center, DgLocVector& vec)
        }
    }
 
-   *this << std::endl;
+   *this << "\n";
 
    return *this;
 
@@ -80,11 +80,14 @@ DgOutNdxParentFile::insert (const DgLocation& center, DgLocation& parent)
       DgLocation tmpLoc(center);
       outRF_->convert(&tmpLoc);
       *this << tmpLoc.asString(' ');
+      // go through the parent grid so the multi-resolution address doesn't
+      // take a round trip through the sphere
+      ndxPrtDgg_.convert(&parent);
       ndxPrtOutRF_->convert(&parent);
       *this << " " << parent.asString(' ');
    }
 
-   *this << std::endl;
+   *this << "\n";
 
    return *this;
 
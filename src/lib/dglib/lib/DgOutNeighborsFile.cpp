@@ -56,7 +56,7 @@ DgOutNeighborsFile::insert (const DgLocation& center, DgLocVector& vec)
          *this << " " << vec[i].asString(' ');
    }
 
-   *this << std::endl;
+   *this << "\n";
 
    return *this;
 
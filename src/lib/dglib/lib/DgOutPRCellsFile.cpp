@@ -59,13 +59,8 @@ DgOutPRCellsFile::insert (const DgDVec2D& pt)
 //
 ////////////////////////////////////////////////////////////////////////////////
 {
-   const int maxBuffSize = 200;
-   char buff[maxBuffSize];
-
    // switch to lat/lon order
-   snprintf(buff, maxBuffSize, formatStr(), pt.y(), pt.x());
-
-   *this << buff;
+   writePoint(pt.y(), pt.x());
 
    return *this;
 
@@ -127,7 +122,7 @@ DgOutPRCellsFile::insert (DgPolygon& poly, const std::string* label,
       this->insert(rf().getVecAddress(*v[i]));
    }
 
-   *this << std::endl;
+   *this << "\n";
 
    return *this;
 
@@ -59,13 +59,8 @@ DgOutPRPtsFile::insert (const DgDVec2D& pt)
 //
 ////////////////////////////////////////////////////////////////////////////////
 {
-   const int maxBuffSize = 200;
-   char buff[maxBuffSize];
-
    // want latitude, longitude
-   snprintf(buff, maxBuffSize, formatStr(), pt.y(), pt.x());
-
-   *this << buff;
+   writePoint(pt.y(), pt.x());
 
    return *this;
 
@@ -57,12 +57,7 @@ DgOutRandPtsText::insert (const DgDVec2D& pt)
 //
 ////////////////////////////////////////////////////////////////////////////////
 {
-   const int maxBuffSize = 200;
-   char buff[maxBuffSize];
-
-   snprintf(buff, maxBuffSize, formatStr(), pt.x(), pt.y());
-
-   *this << buff;
+   writePoint(pt.x(), pt.y());
 
    return *this;
 
@@ -41,6 +41,16 @@ DgOutputStream::DgOutputStream (const std::string& fileName, const std::string&
 
 } // DgOutputStream::DgOutputStream
 
+////////////////////////////////////////////////////////////////////////////////
+DgOutputStream::~DgOutputStream (void)
+{
+   close();
+
+   // detach buffer_ before it is destroyed
+   rdbuf()->pubsetbuf(0, 0);
+
+} // DgOutputStream::~DgOutputStream
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 bool
@@ -62,7 +72,11 @@ DgOutputStream::open (std::string fileName, DgReportLevel failLevel)
       = (suffix() == std::string("")) ? fileName :
                                      fileName + std::string(".") + suffix();
 
-    std::ofstream::open(fileName_.c_str(), std::ios::out);
+   // the buffer must be set before the file is opened
+   if (buffer_.empty()) buffer_.resize(bufferSize);
+   rdbuf()->pubsetbuf(buffer_.data(), (std::streamsize) buffer_.size());
+
+   std::ofstream::open(fileName_.c_str(), std::ios::out);
    if (!good())
    {
       report("DgOutputStream::open() unable to open file " + fileName_,
@@ -70,40 +70,24 @@ DgProjFullerInv::convertTypedAddress (const DgProjTriCoord& addIn) const
 ////////////////////////////////////////////////////////////////////////////////
 DgProjFullerFwd::DgProjFullerFwd (const DgRF<DgGeoCoord, long double>& from,
                     const DgRF<DgProjTriCoord, long double>& to)
-         : DgConverter<DgGeoCoord, long double, DgProjTriCoord, long double>(from, to)
+         : DgIcosaProjFwd(from, to)
 {
-   pProjTriRF_= dynamic_cast<const DgProjTriRF*>(&toFrame());
-
-   if (!pProjTriRF_)
-   {
-      report("DgProjFullerFwd::DgProjFullerFwd(): "
-        " toFrame not of type DgProjTriRF", DgBase::Fatal);
-   }
-
 } // DgProjFullerFwd::DgProjFullerFwd
 
 ////////////////////////////////////////////////////////////////////////////////
 DgProjTriCoord
-DgProjFullerFwd::convertTypedAddress (const DgGeoCoord& addIn) const
+DgProjFullerFwd::projectOnTri (const DgGeoCoord& addIn, int triNum) const
 {
-//cout << "***DgProjFullerFwd: geoPt: " << addIn << std::endl;
-         GeoCoord ll;
+   GeoCoord ll;
 
    ll.lon = addIn.lon();
    ll.lat = addIn.lat();
 
-//cout << "   ll.lon, ll.lat: " << ll.lon << ", " << ll.lat << std::endl;
-
-   IcosaGridPt gridpt = fullerFwd(ll, projTriRF().sphIcosa());
-//cout << "    gridpt.triangle .x .y: " << gridpt.triangle << ", " <<
-//      gridpt.pt.x << ", " << gridpt.pt.y << std::endl;
-
-//cout << "DgProjTriCoord: " << DgProjTriCoord(gridpt.triangle,
-//                               DgDVec2D(gridpt.pt.x, gridpt.pt.y)) << std::endl;
+   IcosaGridPt gridpt = fullerFwd(ll, projTriRF().sphIcosa(), triNum);
 
    return DgProjTriCoord(gridpt.triangle, DgDVec2D(gridpt.pt.x, gridpt.pt.y));
 
-} // DgProjTriCoord DgProjFullerFwd::convertTypedAddress
+} // DgProjTriCoord DgProjFullerFwd::projectOnTri
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -123,10 +107,20 @@ IcosaGridPt fullerFwd (const GeoCoord& ll, DgSphIcosa& sphicosa)
    project the point ll (lat, lon in radius) to the
    plane and return relevant info in IcosaGridPt
 */
+{
+   return fullerFwd(ll, sphicosa, sphicosa.whichIcosaTri(ll));
+
+} /* IcosaGridPt fullerFwd */
+
+////////////////////////////////////////////////////////////////////////////////
+IcosaGridPt fullerFwd (const GeoCoord& ll, DgSphIcosa& sphicosa, int tri)
+/*
+   project the point ll, which lies on icosahedron face tri, to the plane
+*/
 {
    IcosaGridPt gridpt;
 
-   gridpt.triangle = sphicosa.whichIcosaTri(ll);
+   gridpt.triangle = tri;
 
    if (gridpt.triangle < 0)
    {
@@ -22,6 +22,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
 #include <string.h>
 
 #include <dglib/DgProjTriRF.h>
@@ -29,6 +30,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 DgSphIcosa::DgSphIcosa (const DgGeoCoord& vert0, long double azimuthDegs)
+   : precisionMode_ (Exact), inverseMethod_ (Iterative)
 {
    sphIcosa_.pt.lon = vert0.lon();
    sphIcosa_.pt.lat = vert0.lat();
@@ -116,30 +118,103 @@ GeoCoord coordtrans(const GeoCoord& newNPold, const GeoCoord& ptold,
 
 ////////////////////////////////////////////////////////////////////////////////
 int
-DgSphIcosa::whichIcosaTri (const GeoCoord& pt)
+DgSphIcosa::whichIcosaTri (const GeoCoord& pt) const
 /*
    Return the index of the icosahedron triangle in which pt occurs.
+
+   The closest face center has the largest cosine of the great circle
+   distance to pt, which is the dot product of their unit vectors.
 */
 {
-   // start by assuming the first face is the minimum
-   int minFace = 0;
-   long double minDist = DgGeoCoord::gcDist(sphIcosa().triCen[0].pt, pt);
+   if (isFast()) {
+      int tri;
+      whichIcosaTriFast(&pt, &tri, 1);
+      return tri;
+   }
 
-   // compare against the rest of the faces
+   const long double cosLat = cosl(pt.lat);
+   const long double x = cosLat * cosl(pt.lon);
+   const long double y = cosLat * sinl(pt.lon);
+   const long double z = sinl(pt.lat);
+
+   int maxFace = 0;
+   long double maxDot = cenX_[0] * x + cenY_[0] * y + cenZ_[0] * z;
    for (int i = 1; i < 20; i++)
    {
-      const DgGeoCoord& triCen = sphIcosa().triCen[i].pt;
-      long double dist = DgGeoCoord::gcDist(triCen, pt);
-      if (dist < minDist) {
-         minDist = dist;
-         minFace = i;
+      long double dot = cenX_[i] * x + cenY_[i] * y + cenZ_[i] * z;
+      if (dot > maxDot) {
+         maxDot = dot;
+         maxFace = i;
       }
    }
 
-   return minFace;
+   return maxFace;
 
 } /* int DgSphIcosa::whichIcosaTri */
 
+////////////////////////////////////////////////////////////////////////////////
+void
+DgSphIcosa::whichIcosaTri (const GeoCoord* pts, int* tris, size_t n) const
+{
+   if (isFast()) {
+      whichIcosaTriFast(pts, tris, n);
+      return;
+   }
+
+   for (size_t k = 0; k < n; k++)
+      tris[k] = whichIcosaTri(pts[k]);
+
+} /* void DgSphIcosa::whichIcosaTri */
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgSphIcosa::whichIcosaTriFast (const GeoCoord* pts, int* tris, size_t n) const
+/*
+   Double precision face lookup used for single points and blocks of points
+   alike, so that both give the same answer. The loop over the points of a
+   block is free of branches so it vectorizes.
+*/
+{
+   const size_t blockSize = 64;
+   double x[blockSize], y[blockSize], z[blockSize], maxDot[blockSize];
+   int maxFace[blockSize];
+
+   for (size_t k0 = 0; k0 < n; k0 += blockSize)
+   {
+      const size_t m = (n - k0 < blockSize) ? n - k0 : blockSize;
+
+      for (size_t k = 0; k < m; k++)
+      {
+         const double lat = (double) pts[k0 + k].lat;
+         const double lon = (double) pts[k0 + k].lon;
+         const double cosLat = std::cos(lat);
+         x[k] = cosLat * std::cos(lon);
+         y[k] = cosLat * std::sin(lon);
+         z[k] = std::sin(lat);
+         maxDot[k] = -2.0;
+         maxFace[k] = 0;
+      }
+
+      for (int i = 0; i < 20; i++)
+      {
+         const double cx = cenXd_[i];
+         const double cy = cenYd_[i];
+         const double cz = cenZd_[i];
+         for (size_t k = 0; k < m; k++)
+         {
+            const double dot = cx * x[k] + cy * y[k] + cz * z[k];
+            const bool closer = dot > maxDot[k];
+            maxDot[k] = closer ? dot : maxDot[k];
+            maxFace[k] = closer ? i : maxFace[k];
+         }
+      }
+
+      for (size_t k = 0; k < m; k++)
+         tris[k0 + k] = maxFace[k];
+   }
+
+} /* void DgSphIcosa::whichIcosaTriFast */
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgSphIcosa::ico12verts (void)
@@ -234,6 +309,15 @@ for (i = 0; i < 12; i++)
       sphIcosa().triCen[i].cosLat = cosl(sphIcosa().triCen[i].pt.lat);
       sphIcosa().triCen[i].cosLon = cosl(sphIcosa().triCen[i].pt.lon);
 
+      /* the center unit vector for the face lookup */
+
+      cenX_[i] = sphIcosa().triCen[i].cosLat * sphIcosa().triCen[i].cosLon;
+      cenY_[i] = sphIcosa().triCen[i].cosLat * sphIcosa().triCen[i].sinLon;
+      cenZ_[i] = sphIcosa().triCen[i].sinLat;
+      cenXd_[i] = (double) cenX_[i];
+      cenYd_[i] = (double) cenY_[i];
+      cenZd_[i] = (double) cenZ_[i];
+
       /* pre-calculate the dazh's */
 
       const GeoCoord* t = sphIcosa().icotri[i];
@@ -304,10 +388,11 @@ DgProjTriRF::str2add (DgProjTriCoord* add, const char* str, char delimiter)
    delimStr[1] = '\0';
 
    char* tmpStr = new char[strlen(str) + 1];
+   char* tokPos = 0;
    strcpy(tmpStr, str);
 
    // get the triNum
-   char* tok = strtok(tmpStr, delimStr);
+   char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
    int t = -1;
    if (!tok || sscanf(tok, "%d", &t) != 1)
    {
@@ -30,16 +30,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 DgRFNetwork::~DgRFNetwork (void)
 {
-   for (unsigned long long int i = 0; i < size(); i++) {
-      for (unsigned long long int j = 0; j < size(); j++) {
-         //if (matrix_[i][j] && !(matrix_[i][j]->userGenerated())) {
-         if (matrix_[i][j]) {
-            delete matrix_[i][j];
-            matrix_[i][j] = 0;
-         }
-      }
-      matrix_[i].clear();
+   for (auto& conv : converters_) {
+      delete conv.second;
+      conv.second = nullptr;
    }
+   converters_.clear();
 
    for (auto &frame : frames_) {
       delete frame;
@@ -53,7 +48,12 @@ bool
 DgRFNetwork::existsConverter (const DgRFBase& fromFrame,
                                     const DgRFBase& toFrame) const
 {
-   return matrix_[fromFrame.id()][toFrame.id()];
+   if (isFrozen())
+      return findConverter(fromFrame.id(), toFrame.id());
+
+   std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+   return findConverter(fromFrame.id(), toFrame.id());
 
 } // bool DgRFNetwork::existsConverter
 
@@ -80,11 +80,31 @@ DgRFNetwork::getConverter (const DgRFBase& fromFrame,
       return 0;
    }
 
+   // a frozen network already has every converter it can have
+
+   if (isFrozen())
+   {
+      const DgConverterBase* conv =
+                        findConverter(fromFrame.id(), toFrame.id());
+      if (!conv)
+      {
+         report("DgRFNetwork::getConverter() frames not connected: " +
+                 fromFrame.name() + std::string(" -> ") + toFrame.name(),
+                DgBase::Fatal);
+      }
+
+      return conv;
+   }
+
    // check for existing converter
 
-   if (!matrix_[fromFrame.id()][toFrame.id()])
+   std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+   const DgConverterBase* conv = findConverter(fromFrame.id(), toFrame.id());
+   if (!conv)
    {
-      // attempt to generate a passthrough converter
+      // attempt to generate a passthrough converter; it's memoized so the
+      // path between the frames is only found once
 
       if (!fromFrame.connectTo() || !toFrame.connectFrom())
       {
@@ -94,12 +114,13 @@ DgRFNetwork::getConverter (const DgRFBase& fromFrame,
          return 0;
       }
 
-      const_cast<DgRFNetwork*>(this)->matrix_
-                           [fromFrame.id()][toFrame.id()] =
-                                new DgSeriesConverter(fromFrame, toFrame);
+      DgConverterBase* series = new DgSeriesConverter(fromFrame, toFrame);
+      const_cast<DgRFNetwork*>(this)->setConverter(fromFrame.id(),
+                                                   toFrame.id(), series);
+      conv = series;
    }
 
-   return matrix_[fromFrame.id()][toFrame.id()];
+   return conv;
 
 } // const DgConverter* DgRFNetwork::getConverter
 
@@ -107,33 +128,73 @@ DgRFNetwork::getConverter (const DgRFBase& fromFrame,
 void
 DgRFNetwork::update (void)
 {
+   if (isFrozen())
+      report("DgRFNetwork::update() network is frozen", DgBase::Fatal);
+
+   std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+   // remove all of the generated series converters before rebuilding any,
+   // so that no rebuilt converter uses one that is about to be deleted
+   std::vector<unsigned long long int> keys;
+   for (auto it = converters_.begin(); it != converters_.end(); )
+   {
+      const int fromId = (int) (it->first >> 32);
+      const int toId = (int) (it->first & 0xffffffffULL);
+      if (fromId != toId && !it->second->userGenerated())
+      {
+         keys.push_back(it->first);
+         delete it->second;
+         it = converters_.erase(it);
+      }
+      else
+         ++it;
+   }
+
+   for (auto key : keys)
+   {
+      const DgRFBase* fromFrame = frames_[key >> 32];
+      const DgRFBase* toFrame = frames_[key & 0xffffffffULL];
+      if (fromFrame->connectTo() && toFrame->connectFrom() &&
+          !findConverter(fromFrame->id(), toFrame->id()))
+      {
+         setConverter(fromFrame->id(), toFrame->id(),
+                      new DgSeriesConverter(*fromFrame, *toFrame));
+      }
+   }
+
+} // void DgRFNetwork::update
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgRFNetwork::freeze (void)
+{
+   std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+   if (isFrozen())
+      return;
+
    for (unsigned long long int i = 0; i < size(); i++)
    {
+      if (!frames_[i]->connectTo())
+         continue;
+
       for (unsigned long long int j = 0; j < size(); j++)
       {
-         if (i != j && matrix_[i][j] && !matrix_[i][j]->userGenerated())
-         {
-            delete matrix_[i][j];
-            matrix_[i][j] = 0;
-            if (frames_[i]->connectTo() && frames_[j]->connectFrom())
-            {
-               matrix_[i][j] = new DgSeriesConverter(*frames_[i], *frames_[j]);
-            }
-         }
+         if (frames_[j]->connectFrom() && !findConverter((int) i, (int) j))
+            setConverter((int) i, (int) j,
+                         new DgSeriesConverter(*frames_[i], *frames_[j]));
       }
    }
-} // void DgRFNetwork::update
+
+   frozen_.store(true, std::memory_order_release);
+
+} // void DgRFNetwork::freeze
 
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgRFNetwork::reserve (const size_t& capacity)
 {
    frames_.reserve(capacity);
-   matrix_.reserve(capacity);
-
-   for(auto &row : matrix_){
-      row.reserve(capacity);
-   }
 
 } // void DgRFNetwork::reserve
 
@@ -141,14 +202,14 @@ DgRFNetwork::reserve (const size_t& capacity)
 int
 DgRFNetwork::generateId (DgRFBase* frame)
 {
-   frames_.push_back(frame);
-   matrix_.resize(frames_.size());
+   if (isFrozen())
+      report("DgRFNetwork::generateId() network is frozen", DgBase::Fatal);
 
-   for (auto& row : matrix_){
-      row.resize(frames_.size(), 0);
-   }
+   std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+   frames_.push_back(frame);
 
-   matrix_[nextId_][nextId_] = new DgIdentityConverter(*frame);
+   setConverter(nextId_, nextId_, new DgIdentityConverter(*frame));
 
    if (nextId_ == 0)
     frame->connectTo_ = frame->connectFrom_ = frame; // ground
@@ -159,6 +220,19 @@ DgRFNetwork::generateId (DgRFBase* frame)
    nextId_++;
 
    return (nextId_ - 1);
-}
+
+} // int DgRFNetwork::generateId
+
+////////////////////////////////////////////////////////////////////////////////
+DgConverterBase*
+DgRFNetwork::setConverter (int fromId, int toId, DgConverterBase* conv)
+{
+   DgConverterBase*& slot = converters_[converterKey(fromId, toId)];
+   DgConverterBase* old = slot;
+   slot = conv;
+
+   return old;
+
+} // DgConverterBase* DgRFNetwork::setConverter
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <list>
 #include <vector>
 
@@ -67,8 +68,15 @@ DgSeriesConverter::DgSeriesConverter (const DgRFBase& fromFrame,
 
    // if we're here we need to generate a passthrough converter:
    //    fromFrame => network ground => toFrame
+   // stopping short of the ground if the path from the ground to the toFrame
+   // passes through a frame on the way down from the fromFrame
 
    const DgRFNetwork& net = fromFrame.network();
+
+   std::vector<const DgRFBase*> toPath;
+   for (const DgRFBase* f = &toFrame; f && f->id() != 0; f = f->connectFrom())
+      toPath.push_back(f);
+
    int i = 0;
    const DgRFBase* from = &fromFrame;
    series_.resize(0);
@@ -86,9 +94,11 @@ DgSeriesConverter::DgSeriesConverter (const DgRFBase& fromFrame,
          break;
       }
 
-      // are we at the ground?
+      // are we at the ground or on the path to the toFrame?
 
-      if (from->id() == 0) break;
+      if (from->id() == 0 ||
+          std::find(toPath.begin(), toPath.end(), from) != toPath.end())
+         break;
 
       // otherwise keep heading towards the ground
 
@@ -114,15 +124,8 @@ DgSeriesConverter::DgSeriesConverter (const DgRFBase& fromFrame,
 
    if (from->id() == toFrame.id()) return;
 
-   // otherwise we should be at the ground
-
-   if (from->id() != 0)
-   {
-      report("DgSeriesConverter::DgSeriesConverter() ground not "
-             "encountered", DgBase::Fatal);
-   }
-
-   // now build in reverse the series from the ground to the fromFrame
+   // now build in reverse the series from the ground (or the frame where
+   // the two paths meet) to the toFrame
 
    std::list<const DgRFBase*> rev;
    const DgRFBase* ground = from;
@@ -163,7 +166,7 @@ DgSeriesConverter::DgSeriesConverter (const DgRFBase& fromFrame,
 
    // we should be back at ground
 
-   if (from->id() != 0)
+   if (from != ground)
    {
       report("DgSeriesConverter::DgSeriesConverter() ground not "
              "encountered", DgBase::Fatal);
@@ -217,7 +220,7 @@ DgAddressBase*
 DgSeriesConverter::createConvertedAddress (const DgAddressBase& addIn) const
 {
    // keep track of nested series depth for formatting output
-   static int seriesDepth = 0;
+   static thread_local int seriesDepth = 0;
    seriesDepth++;
 
    if (isTraceOn())
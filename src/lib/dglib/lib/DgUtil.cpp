@@ -23,7 +23,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <cmath>
+#include <cstdio>
 #include <iostream>
+#include <limits>
 #include <string.h>
 
 #include <dglib/DgUtil.h>
@@ -35,9 +37,35 @@ long rint(const float& x)
  return static_cast<long>(std::ceil(x));
 }
 
+char* nextToken(char* str, const char* delim, char** save)
+{
+ char* s = (str) ? str : *save;
+ if (!s)
+  return 0;
+
+ s += strspn(s, delim);
+ if (*s == '\0')
+ {
+  *save = s;
+  return 0;
+ }
+
+ char* end = s + strcspn(s, delim);
+ if (*end == '\0')
+  *save = end;
+ else
+ {
+  *end = '\0';
+  *save = end + 1;
+ }
+
+ return s;
+}
+
 void ssplit(const std::string& src, std::vector<std::string>& dest, const char *delim)
 {
- for(char *name = strtok(const_cast<char *>(src.c_str()), delim); 0 != name; name = strtok(0, delim))
+ char* save = 0;
+ for(char *name = nextToken(const_cast<char *>(src.c_str()), delim, &save); 0 != name; name = nextToken(0, delim, &save))
   dest.push_back(name);
 }
 
@@ -64,6 +92,179 @@ std::string toUpper (const std::string& str) {
     return result;
 }
 
+int fixedToStr (char* buf, int bufSize, long double val, int prec)
+{
+ // 10^prec is exact in a long double. Limiting the scaled value to 2^40
+ // keeps its rounding error below 1e-7, so it can be rounded to an integer
+ // directly unless it is near a tie; ties are left to snprintf.
+ const long double maxScaled = 1099511627776.0L;
+ const int maxDigits = 32;
+ if (prec >= 0 && prec <= 18 && bufSize > maxDigits + 2 && std::isfinite(val))
+ {
+  long double p10 = 1.0L;
+  for (int i = 0; i < prec; i++)
+   p10 *= 10.0L;
+
+  const long double s = std::fabs(val) * p10;
+  const long double fl = std::floor(s);
+  const long double frac = s - fl;
+  if (s < maxScaled && std::fabs(frac - 0.5L) > 1.0E-6L)
+  {
+   unsigned long long n = (unsigned long long) fl + ((frac > 0.5L) ? 1 : 0);
+
+   // the digits in reverse order, with at least one before the point
+   char digits[maxDigits];
+   int nd = 0;
+   do
+   {
+    digits[nd++] = (char) ('0' + n % 10);
+    n /= 10;
+   } while (n);
+
+   while (nd <= prec)
+    digits[nd++] = '0';
+
+   char* p = buf;
+   if (std::signbit(val))
+    *p++ = '-';
+
+   for (int i = nd - 1; i >= prec; i--)
+    *p++ = digits[i];
+
+   *p++ = '.';
+   for (int i = prec - 1; i >= 0; i--)
+    *p++ = digits[i];
+
+   *p = '\0';
+   return (int) (p - buf);
+  }
+ }
+
+ return snprintf(buf, bufSize, "%#.*LF", prec, val);
+}
+
+// scan a plain decimal number into its sign, significant digits and
+// decimal exponent; returns a pointer past the number or first if it
+// can't be represented that way
+static const char* scanDecimal (const char* first, const char* last,
+                      bool& neg, unsigned long long& m, int& e10)
+{
+ const int maxSigDigits = 19;  // less than 2^64
+ const char* p = first;
+ neg = false;
+ if (p < last && (*p == '-' || *p == '+'))
+ {
+  neg = (*p == '-');
+  p++;
+ }
+
+ m = 0;
+ e10 = 0;
+ int nDigits = 0;
+ int nSig = 0;
+ for (; p < last && *p >= '0' && *p <= '9'; p++, nDigits++)
+ {
+  if (m == 0 && *p == '0') continue;
+  if (++nSig > maxSigDigits) return first;
+  m = m * 10 + (*p - '0');
+ }
+
+ // strtod reads "0x..." as hexadecimal
+ if (nDigits == 1 && m == 0 && p < last && (*p == 'x' || *p == 'X'))
+  return first;
+
+ if (p < last && *p == '.')
+ {
+  for (p++; p < last && *p >= '0' && *p <= '9'; p++, nDigits++)
+  {
+   if (m == 0 && *p == '0')
+   {
+    e10--;
+    continue;
+   }
+   if (++nSig > maxSigDigits) return first;
+   m = m * 10 + (*p - '0');
+   e10--;
+  }
+ }
+
+ if (nDigits == 0) return first;
+
+ // the exponent is only part of the number if it has digits
+ if (p < last && (*p == 'e' || *p == 'E'))
+ {
+  const char* q = p + 1;
+  bool eNeg = false;
+  if (q < last && (*q == '-' || *q == '+'))
+  {
+   eNeg = (*q == '-');
+   q++;
+  }
+
+  if (q < last && *q >= '0' && *q <= '9')
+  {
+   int e = 0;
+   for (; q < last && *q >= '0' && *q <= '9'; q++)
+   {
+    if (e > 10000) return first;
+    e = e * 10 + (*q - '0');
+   }
+   e10 += (eNeg) ? -e : e;
+   p = q;
+  }
+ }
+
+ return p;
+}
+
+// m * 10^e10 is exact if m and 10^|e10| are exactly representable, since
+// then a single correctly rounded multiply or divide gives the result
+template <class T>
+static bool exactDecimal (bool neg, unsigned long long m, int e10, T& val)
+{
+ const int digits = std::numeric_limits<T>::digits;
+ if (digits < 64 && (m >> (digits < 64 ? digits : 0)))
+  return false;
+
+ // the largest power of ten with 5^e < 2^digits
+ const int maxExp10 = (int) (digits * 0.43067655807339306); // log(2)/log(5)
+ if (e10 > maxExp10 || e10 < -maxExp10)
+  return false;
+
+ T p10 = 1;
+ for (int i = 0; i < ((e10 < 0) ? -e10 : e10); i++)
+  p10 *= 10;
+
+ val = (e10 < 0) ? (T) m / p10 : (T) m * p10;
+ if (neg) val = -val;
+
+ return true;
+}
+
+const char* fromChars (const char* first, const char* last, double& val)
+{
+ bool neg;
+ unsigned long long m;
+ int e10;
+ const char* p = scanDecimal(first, last, neg, m, e10);
+ if (p == first || !exactDecimal(neg, m, e10, val))
+  return first;
+
+ return p;
+}
+
+const char* fromChars (const char* first, const char* last, long double& val)
+{
+ bool neg;
+ unsigned long long m;
+ int e10;
+ const char* p = scanDecimal(first, last, neg, m, e10);
+ if (p == first || !exactDecimal(neg, m, e10, val))
+  return first;
+
+ return p;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 }} // namespace dgg::util
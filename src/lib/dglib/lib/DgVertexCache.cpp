@@ -0,0 +1,98 @@
+/*******************************************************************************
+    Copyright (C) 2023 Kevin Sahr
+
+    This file is part of DGGRID.
+
+    DGGRID is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    DGGRID is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+//
+// DgVertexCache.cpp: DgVertexCache class implementation
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <dglib/DgIDGGBase.h>
+#include <dglib/DgVertexCache.h>
+
+////////////////////////////////////////////////////////////////////////////////
+DgVertexCache::Key
+DgVertexCache::makeKey (int quadNum, const DgDVec2D& pt) const
+{
+   Key k;
+   k.quadNum = quadNum;
+   k.x = pt.x();
+   k.y = pt.y();
+
+   return k;
+
+} // DgVertexCache::Key DgVertexCache::makeKey
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgVertexCache::setDgg (const DgIDGGBase& dgg)
+{
+   if (dgg_ != &dgg) {
+      clear();
+      dgg_ = &dgg;
+   }
+
+} // void DgVertexCache::setDgg
+
+////////////////////////////////////////////////////////////////////////////////
+const DgVertexCache::DgVertexVal*
+DgVertexCache::find (int quadNum, const DgDVec2D& pt)
+{
+   const Key k = makeKey(quadNum, pt);
+
+   auto it = cur_.find(k);
+   if (it != cur_.end()) {
+      nHits_++;
+      return &it->second;
+   }
+
+   it = prev_.find(k);
+   if (it != prev_.end()) {
+      nHits_++;
+      return &it->second;
+   }
+
+   nMisses_++;
+   return nullptr;
+
+} // const DgVertexCache::DgVertexVal* DgVertexCache::find
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgVertexCache::insert (int quadNum, const DgDVec2D& pt, const DgVertexVal& val)
+{
+   if (cur_.size() >= genSize_) {
+      prev_.swap(cur_);
+      cur_.clear();
+   }
+
+   cur_[makeKey(quadNum, pt)] = val;
+
+} // void DgVertexCache::insert
+
+////////////////////////////////////////////////////////////////////////////////
+void
+DgVertexCache::clear (void)
+{
+   cur_.clear();
+   prev_.clear();
+
+} // void DgVertexCache::clear
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
@@ -82,6 +82,31 @@ class DgIDGGSBase;
 ////////////////////////////////////////////////////////////////////////////////
 int DgZ3System::defaultInvalidDigit = 3;
 
+////////////////////////////////////////////////////////////////////////////////
+// a Z3 index initialized to each possible padding digit
+static const uint64_t z3FillDigit[4] = {
+    UINT64_C(0x0000000000000000), // index 0: base-4 digit 0 repeated (00)
+    UINT64_C(0x5555555555555555), // index 1: base-4 digit 1 repeated (01)
+    UINT64_C(0xAAAAAAAAAAAAAAAA), // index 2: base-4 digit 2 repeated (10)
+    UINT64_C(0xFFFFFFFFFFFFFFFF)  // index 3: base-4 digit 3 repeated (11)
+};
+
+// the pair of Z3 digits for each pair of base 3 i and j digits, packed
+// into 4 bits as (first digit << 2) | second digit
+static const int z3PairCode[3][3] = {
+    { 0x0, 0xA, 0x9 }, // 00 22 21
+    { 0x1, 0x2, 0x8 }, // 01 02 20
+    { 0x6, 0x4, 0x5 }  // 12 10 11
+};
+
+// the inverse of z3PairCode, giving (i digit * 3 + j digit); -1 is invalid
+static const int z3PairDigits[16] = {
+     0,  3,  4, -1,    // 00 01 02 03
+     7,  8,  6, -1,    // 10 11 12 13
+     5,  2,  1, -1,    // 20 21 22 23
+    -1, -1, -1, -1     // 30 31 32 33
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 DgZ3System::DgZ3System (const DgIDGGSBase& dggsIn, bool extModeIntIn, const std::string& nameIn)
    : DgHierNdxSystemRFS<DgZ3RF, DgZ3StringRF>(dggsIn, extModeIntIn, nameIn)
@@ -93,56 +118,31 @@ DgZ3System::DgZ3System (const DgIDGGSBase& dggsIn, bool extModeIntIn, const std:
 DgHierNdxIntCoord
 DgZ3System::toIntCoord (const DgHierNdxStringCoord& addIn, int gridRes) const
 {
-    std::string addstr = addIn.valString();
+    const std::string addstr = addIn.value();
     if (addstr.size() - 2 > MAX_Z3_RES) {
        report("DgZ3System::toIntCoord(): "
         " input resolution exceeds max Z3 resolution of 30", DgBase::Fatal);
     }
 
-    // initialize the Z3 index so it is padded with the correct value
-    static uint64_t fillDigit[4] = {
-        UINT64_C(0x0000000000000000), // index 0: base-4 digit 0 repeated (00)
-        UINT64_C(0x5555555555555555), // index 1: base-4 digit 1 repeated (01)
-        UINT64_C(0xAAAAAAAAAAAAAAAA), // index 2: base-4 digit 2 repeated (10)
-        UINT64_C(0xFFFFFFFFFFFFFFFF)  // index 3: base-4 digit 3 repeated (11)
-    };
-
-    uint64_t z = fillDigit[DgZ3System::defaultInvalidDigit];
-
-    // first get the quad number and add to the val
-    std::string qstr = addstr.substr(0, 2);
-    if (qstr[0] == '0') // leading 0
-       qstr = qstr.substr(1, 1);
-    int quadNum = std::stoi(qstr);
-    Z3_SET_QUADNUM(z, quadNum);
-
-    int index = 2; // skip the two quad digits
-
-    // the rest is the radix string — length must match grid resolution
-    std::string radStr = addstr.substr(index);
-    if ((int) radStr.size() != gridRes) {
+    // the length must match grid resolution
+    int nDigits = (int) addstr.size() - 2;
+    if (nDigits != gridRes) {
        report("DgZ3System::toIntCoord(): Z3 digit string must have exactly "
               "gridRes radix digits after the base cell (2 digits); got " +
-              dgg::util::to_string((int) radStr.size()) + " expected " +
+              dgg::util::to_string(nDigits) + " expected " +
               dgg::util::to_string(gridRes),
               DgBase::Fatal);
     }
 
-    int r = 1;
-    for (const char& digit: radStr) {
-       int d = digit - '0'; // convert to int
-       Z3_SET_INDEX_DIGIT(z, r, d);
-       r++;
-    }
- /*
-    // pad as needed
-    if (DgZ3RF::defaultInvalidDigit != 0) {
-       while (r <= MAX_Z3_RES) {
-          Z3_SET_INDEX_DIGIT(z, r, DgZ3RF::defaultInvalidDigit);
-          r++;
-       }
-    }
-  */
+    // initialize the Z3 index so it is padded with the correct value
+    uint64_t z = z3FillDigit[DgZ3System::defaultInvalidDigit];
+
+    // the two quad digits
+    int quadNum = (addstr[0] - '0') * 10 + (addstr[1] - '0');
+    Z3_SET_QUADNUM(z, quadNum);
+
+    for (int r = 1; r <= nDigits; r++)
+       Z3_SET_INDEX_DIGIT(z, r, addstr[r + 1] - '0');
 
     DgHierNdxIntCoord coord;
     coord.setValue(z);
@@ -158,16 +158,12 @@ DgZ3System::toStringCoord (const DgHierNdxIntCoord& addIn, int gridRes) const
     uint64_t z = addIn.value();
 
     int quadNum = Z3_GET_QUADNUM(z);
-    std::string s = dgg::util::to_string(quadNum, 2);
-
-    for (int r = 1; r <= gridRes; r++) {
-       // get the integer digit
-       char d = Z3_GET_INDEX_DIGIT(z, r);
-       // convert to char
-       d += '0';
-       // append to index string
-       s += d;
-    }
+    std::string s(gridRes + 2, '0');
+    s[0] = (char) ('0' + quadNum / 10);
+    s[1] = (char) ('0' + quadNum % 10);
+
+    for (int r = 1; r <= gridRes; r++)
+       s[r + 1] = (char) ('0' + Z3_GET_INDEX_DIGIT(z, r));
 
     DgHierNdxStringCoord zStr;
     zStr.setValue(s);
@@ -175,6 +171,87 @@ DgZ3System::toStringCoord (const DgHierNdxIntCoord& addIn, int gridRes) const
     return zStr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+DgHierNdxIntCoord
+DgZ3System::quantifyInt (const DgQ2DICoord& add, int gridRes) const
+{
+    // the number of Class I resolutions; each contributes a base 3 digit
+    // of i and j, encoded as a pair of Z3 digits
+    const int effRes = (gridRes + 1) / 2;
+
+    // Class II resolutions drop the last Z3 digit
+    int nDigits = 2 * effRes;
+    if (effRes > 0 && !dgg(gridRes).isClassI())
+       nDigits--;
+
+    if (nDigits != gridRes || gridRes > MAX_Z3_RES) {
+       report("DgZ3System::quantifyInt(): invalid Z3 resolution " +
+              dgg::util::to_string(gridRes), DgBase::Fatal);
+    }
+
+    long long int i = add.coord().i();
+    long long int j = add.coord().j();
+    if (i < 0 || j < 0) {
+       report("DgZ3System::quantifyInt(): negative coordinate", DgBase::Fatal);
+    }
+
+    uint64_t z = z3FillDigit[DgZ3System::defaultInvalidDigit];
+    Z3_SET_QUADNUM(z, add.quadNum());
+
+    // least significant digits first
+    for (int k = effRes - 1; k >= 0; k--) {
+       const int code = z3PairCode[i % 3][j % 3];
+       i /= 3;
+       j /= 3;
+
+       const int r = 2 * k + 1;
+       Z3_SET_INDEX_DIGIT(z, r, code >> 2);
+       if (r < nDigits)
+          Z3_SET_INDEX_DIGIT(z, r + 1, code & 3);
+    }
+
+    if (i || j) {
+       report("DgZ3System::quantifyInt(): coordinate out of range for "
+              "resolution " + dgg::util::to_string(gridRes), DgBase::Fatal);
+    }
+
+    DgHierNdxIntCoord coord;
+    coord.setValue(z);
+
+    return coord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgZ3System::invQuantifyInt (const DgHierNdxIntCoord& addIn, int gridRes) const
+{
+    uint64_t z = addIn.value();
+
+    int quadNum = Z3_GET_QUADNUM(z);
+
+    // a missing last digit (Class II) is taken as 0
+    const int effRes = (gridRes + 1) / 2;
+    long long int i = 0;
+    long long int j = 0;
+    for (int k = 0; k < effRes; k++) {
+       const int r = 2 * k + 1;
+       int code = Z3_GET_INDEX_DIGIT(z, r) << 2;
+       if (r < gridRes)
+          code |= Z3_GET_INDEX_DIGIT(z, r + 1);
+
+       const int ij = z3PairDigits[code];
+       if (ij < 0) {
+          report("DgZ3System::invQuantifyInt(): invalid Z3 digit pair in "
+                 "index " + addIn.valString(), DgBase::Fatal);
+       }
+
+       i = i * 3 + ij / 3;
+       j = j * 3 + ij % 3;
+    }
+
+    return DgQ2DICoord(quadNum, DgIVec2D(i, j));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgZ3System::setAddNdxParent (const DgResAdd<DgHierNdx>& add,
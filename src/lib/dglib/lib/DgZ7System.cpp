@@ -80,6 +80,17 @@ class DgIDGGSBase;
             (((uint64_t)(digit))                                            \
              << ((MAX_Z7_RES - (res)) * Z7_PER_DIGIT_OFFSET)))
 
+////////////////////////////////////////////////////////////////////////////////
+// fill the digits of z finer than res with the invalid digit
+static inline uint64_t
+z7PadDigits (uint64_t z, int res)
+{
+   for (int r = res + 1; r <= MAX_Z7_RES; r++)
+      Z7_SET_INDEX_DIGIT(z, r, DgIVec3D::INVALID_DIGIT);
+
+   return z;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 DgZ7System::DgZ7System (const DgIDGGSBase& dggsIn, bool extModeIntIn, const std::string& nameIn)
    : DgHierNdxSystemRFS<DgZ7RF, DgZ7StringRF>(dggsIn, extModeIntIn, nameIn)
@@ -106,50 +117,36 @@ DgZ7System::DgZ7System (const DgIDGGSBase& dggsIn, bool extModeIntIn, const std:
 DgHierNdxIntCoord
 DgZ7System::toIntCoord (const DgHierNdxStringCoord& addIn, int gridRes) const
 {
-   std::string addstr = addIn.valString();
+   const std::string addstr = addIn.value();
     if (addstr.size() - 2 > MAX_Z7_RES) {
      report("DgZ7System::toIntCoord(): "
         " input resolution exceeds max Z7 resolution of 20", DgBase::Fatal);
    }
 
-   uint64_t z = 0;
-
-   // first get the quad number and add to the val
-   std::string qstr = addstr.substr(0, 2);
-   if (qstr[0] == '0') // leading 0
-      qstr = qstr.substr(1, 1);
-   int quadNum = std::stoi(qstr);
-
-   // KEVIN: check for deleted sub-sequence
-
-   Z7_SET_QUADNUM(z, quadNum);
-
-   int index = 2; // skip the two quad digits
-
-   // the rest is the radix string — length must match grid resolution
-   std::string radStr = addstr.substr(index);
-   if ((int) radStr.size() != gridRes) {
+   // the length must match grid resolution
+   int nDigits = (int) addstr.size() - 2;
+   if (nDigits != gridRes) {
       report("DgZ7System::toIntCoord(): Z7 digit string must have exactly "
              "gridRes radix digits after the base cell (2 digits); got " +
-             dgg::util::to_string((int) radStr.size()) + " expected " +
+             dgg::util::to_string(nDigits) + " expected " +
              dgg::util::to_string(gridRes),
              DgBase::Fatal);
    }
 
-   int r = 1;
-   for (const char& digit: radStr) {
-      int d = digit - '0'; // convert to int
-      Z7_SET_INDEX_DIGIT(z, r, d);
-      r++;
-   }
+   uint64_t z = 0;
 
-   while (r <= MAX_Z7_RES) {
-       Z7_SET_INDEX_DIGIT(z, r, DgIVec3D::INVALID_DIGIT);
-       r++;
-    }
+   // the two quad digits
+   int quadNum = (addstr[0] - '0') * 10 + (addstr[1] - '0');
+
+   // KEVIN: check for deleted sub-sequence
+
+   Z7_SET_QUADNUM(z, quadNum);
+
+   for (int r = 1; r <= nDigits; r++)
+      Z7_SET_INDEX_DIGIT(z, r, addstr[r + 1] - '0');
 
    DgHierNdxIntCoord coord;
-   coord.setValue(z);
+   coord.setValue(z7PadDigits(z, nDigits));
 
    return coord;
 }
@@ -161,16 +158,12 @@ DgZ7System::toStringCoord (const DgHierNdxIntCoord& addIn, int gridRes) const
    uint64_t z = addIn.value();
 
    int quadNum = Z7_GET_QUADNUM(z);
-   std::string s = dgg::util::to_string(quadNum, 2);
-
-   for (int r = 1; r <= gridRes; r++) {
-      // get the integer digit
-      char d = Z7_GET_INDEX_DIGIT(z, r);
-      // convert to char
-      d += '0';
-      // append to index string
-      s += d;
-   }
+   std::string s(gridRes + 2, '0');
+   s[0] = (char) ('0' + quadNum / 10);
+   s[1] = (char) ('0' + quadNum % 10);
+
+   for (int r = 1; r <= gridRes; r++)
+      s[r + 1] = (char) ('0' + Z7_GET_INDEX_DIGIT(z, r));
 
    DgHierNdxStringCoord zStr;
    zStr.setValue(s);
@@ -178,6 +171,327 @@ DgZ7System::toStringCoord (const DgHierNdxIntCoord& addIn, int gridRes) const
    return zStr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+DgHierNdxIntCoord
+DgZ7System::quantifyInt (const DgQ2DICoord& addIn, int gridRes) const
+{
+    if (gridRes > MAX_Z7_RES) {
+       report("DgZ7System::quantifyInt(): "
+          " resolution exceeds max Z7 resolution of 20", DgBase::Fatal);
+    }
+
+    // we need to find the correct base cell for this index;
+    // start with the passed in quad and resolution res ijk coordinates
+    // in that quad's coordinate system
+    DgIVec3D ijk = addIn.coord();
+    int baseCell = addIn.quadNum();
+    DgIVec3D baseCellIjk = ijk;
+    int res = gridRes;
+    bool isClassIII = res % 2; // odd resolutions are Class III
+    // for Class III effective res of q2di is the Class I substrate
+    int effectiveRes = (isClassIII) ? res + 1 : res;
+
+    // build the Z7 index from finest res up
+    // adjust r for the fact that the res 0 base cell offsets the indexing
+    // digits
+    DgIVec3D::Direction digits[MAX_Z7_RES + 1];
+    for (int r = 0; r < res+1; r++) digits[r] = DgIVec3D::INVALID_DIGIT;
+    bool first = true;
+    for (int r = effectiveRes; r >= 0; r--) {
+        DgIVec3D lastIJK = ijk;
+        DgIVec3D lastCenter;
+        // why is H3 different?
+        //if ((r + 1) % 2) { // finer res is Class III
+        //if (!((r + 1) % 2)) { // finer res is Class I
+        if (r % 2) { // Class III
+            // rotate ccw
+            ijk.upAp7();
+            lastCenter = ijk;
+            lastCenter.downAp7();
+        } else {
+            // rotate cw
+            ijk.upAp7r();
+            lastCenter = ijk;
+            lastCenter.downAp7r();
+        }
+
+        // res 1 address is our lookup for adjacent base cells
+        if (r == 1)
+            baseCellIjk = ijk;
+
+        // no digit generated for Class I substrate
+        if (first && isClassIII) {
+           first = false;
+           continue;
+        }
+
+        DgIVec3D diff = lastIJK.diffVec(lastCenter);
+        // don't need to normalize; done in unitIjkPlusToDigit
+        //diff.ijkPlusNormalize();
+
+        digits[r] = diff.unitIjkPlusToDigit();
+        //H3_SET_INDEX_DIGIT(h, r + 1, _unitIjkToDigit(&diff));
+    }
+
+    // adjust the base cell if necessary
+    // {i, j} = {0,0}, {1, 0}, {1, 1}, and {0,1} respectively
+    static const int adjacentBaseCellTable[12][4] = {
+        { 0, 0, 0, 0 },
+        { 1, 6, 2, 0 },
+        { 2, 7, 3, 0 },
+        { 3, 8, 4, 0 },
+        { 4, 9, 5, 0 },
+        { 5, 10, 1, 0 },
+        { 6, 11, 7, 2 },
+        { 7, 11, 8, 3 },
+        { 8, 11, 9, 4 },
+        { 9, 11, 10, 5 },
+        { 10, 11, 6, 1 },
+        { 11, 11, 0, 0 }
+    };
+
+    int quadOriginBaseCell = baseCell;
+    if (baseCellIjk.i() == 1) {
+        if (baseCellIjk.j() == 0) // { 1, 0 }
+            baseCell = adjacentBaseCellTable[baseCell][1];
+        else // better be 1
+            baseCell = adjacentBaseCellTable[baseCell][2];
+    } else if (baseCellIjk.j() == 1) // { 0, 1 }
+        baseCell = adjacentBaseCellTable[baseCell][3];
+
+    // all base cells should be correct except for 0 and 11
+    // Base Cell 0 maps to all 5’s, rotate into correct subdigit, skip 2
+    // BC 1 - 5 skip subsequence 2
+    // BC 6 - 10 skip subsequence 5
+    // BC 11 maps to all 2’s, rotate into position, skip 5
+
+    // handle the single-cell quads 0 and 11
+    if (baseCell != quadOriginBaseCell) {
+        if (baseCell == 0) {
+            // must be quad 1 - 5
+            // rotate once for each quad past 1
+            for (int q = 1; q < quadOriginBaseCell; q++) {
+                DgIVec3D::rotateDigitVecCCW(digits, res, DgIVec3D::PENTAGON_SKIPPED_DIGIT_TYPE1);
+            }
+        } else if (baseCell == 11) {
+            // must be quad 6 - 10
+            // rotate once for each quad less than 10
+            int numRots = 10 - quadOriginBaseCell;
+            for (int q = 0; q < numRots; q++) {
+                DgIVec3D::rotateDigitVecCCW(digits, res, DgIVec3D::PENTAGON_SKIPPED_DIGIT_TYPE2);
+            }
+        }
+    }
+
+    uint64_t z = 0;
+    Z7_SET_QUADNUM(z, baseCell);
+
+    DgIVec3D::Direction skipDigit = ((baseCell < 6) ? DgIVec3D::PENTAGON_SKIPPED_DIGIT_TYPE1 : DgIVec3D::PENTAGON_SKIPPED_DIGIT_TYPE2);
+    int skipRotate = false;
+    int firstNonZero = false;
+    for (int r = 1; r < res+1; r++) {
+        DgIVec3D::Direction d = digits[r];
+        if (!firstNonZero && d != DgIVec3D::CENTER_DIGIT) {
+            firstNonZero = true;
+            if (d == skipDigit)
+                skipRotate = true;
+        }
+
+        if (skipRotate) {
+            d = DgIVec3D::rotate60ccw(d);
+        }
+
+        Z7_SET_INDEX_DIGIT(z, r, d);
+    }
+
+    DgHierNdxIntCoord c;
+    c.setValue(z7PadDigits(z, res));
+
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgZ7System::invQuantifyInt (const DgHierNdxIntCoord& addIn, int gridRes) const
+{
+   uint64_t z = addIn.value();
+
+   // first get the base cell number
+   int bcNum = Z7_GET_QUADNUM(z);
+    if (bcNum < 0 || bcNum > 11) {
+        report("DgZ7System::invQuantifyInt(): "
+           "index has invalid base cell number", DgBase::Fatal);
+     }
+
+    // res 0 is just the quad number
+    if (gridRes == 0)
+       return DgQ2DICoord(bcNum, DgIVec2D(0, 0));
+
+   // adjust if Class III (odd res)
+    int res = gridRes;
+    if (res % 2)
+        res++;
+
+    // number of cells along a quad edge at the Class I substrate resolution
+    long long int unitScale = 1;
+    for (int r = 0; r < res / 2; r++)
+       unitScale *= 7;
+
+   DgIVec3D ijk = { 0, 0, 0 };
+   for (int r = 0; r < res; r++) {
+       if ((r + 1) % 2) { // first res is 1, not 0
+           // Class III == rotate ccw
+           ijk.downAp7();
+       } else {
+           // Class I == rotate cw
+           ijk.downAp7r();
+       }
+
+       // a missing last digit (Class III) is taken as 0
+       int d = (r < gridRes) ? Z7_GET_INDEX_DIGIT(z, r + 1) : 0;
+       ijk.neighbor((DgIVec3D::Direction) d);
+   }
+
+   DgIVec2D ij = DgIVec2D(ijk);
+   int quadNum = bcNum;
+
+    if (ij.i() == 0 && ij.j() == 0) {
+         return DgQ2DICoord(quadNum, DgIVec2D(0, 0));
+    }
+
+    static const int inverseAdjacentBaseCellTable[12][2] = {
+        { 0,  0 }, // q0
+        { 5, 10 }, // q1
+        { 1,  6 }, // q2
+        { 2,  7 }, // q3
+        { 3,  8 }, // q4
+        { 4,  9 }, // q5
+        { 10, 1 }, // q6
+        { 6,  2 }, // q7
+        { 7,  3 }, // q8
+        { 8,  4 }, // q9
+        { 9,  5 }, // q10
+        { 11, 11 } // q11
+    };
+
+    bool negI = ij.i() < 0;
+    bool negJ = ij.j() < 0;
+    long int origI = ij.i();
+    if (bcNum == 0) {
+        if (!negI) {
+            if (!negJ) { // +i, +j
+                if (ij.i() > ij.j()) {
+                    quadNum = 2;
+                    ij.setI(ij.j());
+                    ij.setJ(unitScale - (origI - ij.j()));
+                } else { // i <= j
+                    quadNum = 3;
+                    ij.setI(ij.j() - ij.i());
+                    ij.setJ(unitScale - origI);
+                }
+            } else { // +i, -j}
+                quadNum = 1;
+                ij.setJ(ij.j() + unitScale);
+            }
+        } else { //  -i
+            if (!negJ) {
+                if (ij.j() == 0) {
+                    quadNum = 4;
+                    ij.setJ(unitScale + ij.i());
+                    ij.setI(0);
+                } else { // -i, i > 0
+                    quadNum = 3;
+                    ij.setI(-ij.i());
+                    ij.setJ(unitScale - ij.j());
+                }
+            } else { //  -i, j < 0
+                if (ij.i() < ij.j()) {
+                    quadNum = 4;
+                    ij.setI(-ij.j());
+                    ij.setJ(unitScale - (-origI + ij.j()));
+                } else { // i >= j
+                    quadNum = 5;
+                    ij.setI(origI - ij.j());
+                    ij.setJ(unitScale + origI);
+                }
+            }
+        }
+    } else if (bcNum == 11) {
+        if (!negI) { // +i
+            if (!negJ) { // +i, +j
+                if (ij.i() == 0) {
+                    quadNum = 6;
+                    ij.setI(unitScale - ij.j());
+                    ij.setJ(0);
+                } else if (ij.j() == 0) {
+                    quadNum = 8;
+                    ij.setI(unitScale - ij.i());
+                    ij.setJ(0);
+                } else if (ij.j() > ij.i()) {
+                    quadNum = 6;
+                    ij.setI(unitScale - (ij.j() - ij.i()));
+                    ij.setJ(origI);
+                } else { // 0 < j <= i
+                    quadNum = 7;
+                    ij.setI(unitScale - ij.j());
+                    ij.setJ(origI - ij.j());
+                }
+            } else { // +i, -j
+                quadNum = 8;
+                ij.setI(unitScale - ij.i());
+                ij.setJ(-ij.j());
+            }
+        } else { // -i
+            if (negJ) {
+                if (ij.i() > ij.j()) {
+                    quadNum = 8;
+                    ij.setI(unitScale - (-ij.j() + ij.i()));
+                    ij.setJ(-origI);
+                } else {
+                    quadNum = 9;
+                    ij.setI(unitScale + ij.j());
+                    ij.setJ(-origI + ij.j());
+                }
+            } else { // -i, +j
+                quadNum = 10;
+                ij.setI(unitScale + ij.i());
+            }
+        }
+    } else if (bcNum < 6) { // 1 - 5
+        if (negJ) {
+            ij.setJ(ij.j() + unitScale);
+            if (negI) { // both negative
+                ij.setI(ij.i() + unitScale);
+                quadNum = inverseAdjacentBaseCellTable[bcNum][0];
+            } else { // only j negative
+                quadNum = inverseAdjacentBaseCellTable[bcNum][1];
+            }
+        } else if (negI) {
+            // need to rotate digit 3 into the missing digit 2 area
+            DgIVec3D ijk(ij);
+            ijk.ijkRotate60cw();
+            ij = DgIVec2D(ijk);
+        }
+    } else { // 6 - 10
+        if (negI) {
+            ij.setI(ij.i() + unitScale);
+            if (negJ) { // both negative
+                ij.setJ(ij.j() + unitScale);
+                quadNum = inverseAdjacentBaseCellTable[bcNum][0];
+            } else { // only i negative
+                quadNum = inverseAdjacentBaseCellTable[bcNum][1];
+            }
+        } else if (negJ) { // only j negative
+            ij.setI(ij.j() + unitScale);
+            ij.setJ(ij.j() + unitScale - origI);
+
+            quadNum = inverseAdjacentBaseCellTable[bcNum][0];
+        }
+    }
+
+   return DgQ2DICoord(quadNum, ij);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgZ7System::setAddNdxParent (const DgResAdd<DgHierNdx>& add,
@@ -185,12 +499,13 @@ DgZ7System::setAddNdxParent (const DgResAdd<DgHierNdx>& add,
 {
     // res has already been verified by the caller
     int pRes = add.res() - 1;
-    std::string addStr = add.address().strNdx().value();
-    std::string pStr = addStr.substr(0, addStr.size() - 1);
+
+    // the parent drops the last digit
+    uint64_t z = z7PadDigits(add.address().intNdx().value(), pRes);
 
     // build the parent address
     DgResAdd<DgHierNdx> pAdd;
-    initNdxFromString(pAdd, pRes, pStr);
+    initNdxFromInt(pAdd, pRes, z);
     forceAddress(&parent, pAdd);
 }
 
@@ -199,29 +514,26 @@ void
 DgZ7System::setAddNdxChildren (const DgResAdd<DgHierNdx>& add,
                                      DgLocVector& children) const
 {
-    int chdRes = add.res() + 1;
-    std::string valStr = add.address().strNdx().value();
+    int res = add.res();
+    int chdRes = res + 1;
+    uint64_t z = add.address().intNdx().value();
 
     // first get the base cell number
-    std::string quadStr = valStr.substr(0, 2);
-    if (quadStr[0] == '0') // leading 0
-          quadStr = quadStr.substr(1, 1);
-      int quadNum = std::stoi(quadStr);
-      if (quadNum < 0 || quadNum > 11) {
-           report("DgZ7System::setAddNdxChildren(): "
-              "index has invalid base cell number", DgBase::Fatal);
-     }
-
-    std::string addStr = valStr.substr(2);
+    int quadNum = Z7_GET_QUADNUM(z);
+    if (quadNum < 0 || quadNum > 11) {
+         report("DgZ7System::setAddNdxChildren(): "
+            "index has invalid base cell number", DgBase::Fatal);
+    }
 
-    // KEVIN: this should all be done with integers and c_str's
     // assume no skip digit
     int skipDigit = -1;
     // check if current address is all zeros
-    size_t pos = addStr.find_first_not_of('0');
-    if (pos == std::string::npos) { // all digits are zero
+    bool allZero = true;
+    for (int r = 1; r <= res && allZero; r++)
+       allZero = (Z7_GET_INDEX_DIGIT(z, r) == DgIVec3D::CENTER_DIGIT);
+
+    if (allZero)
         skipDigit = (quadNum <= 5) ? 2 : 5;
-    }
 
     children.clearAddress();
     std::vector<DgAddressBase*>& v = children.addressVec();
@@ -233,9 +545,10 @@ DgZ7System::setAddNdxChildren (const DgResAdd<DgHierNdx>& add,
             continue;
 
         // build the child address
-        std::string chdStr = valStr + std::to_string(i);
+        uint64_t chdZ = z7PadDigits(z, chdRes);
+        Z7_SET_INDEX_DIGIT(chdZ, chdRes, i);
         DgResAdd<DgHierNdx> chdAdd;
-        initNdxFromString(chdAdd, chdRes, chdStr);
+        initNdxFromInt(chdAdd, chdRes, chdZ);
 
         v.push_back(new DgAddress<DgResAdd<DgHierNdx>>(chdAdd));
     }
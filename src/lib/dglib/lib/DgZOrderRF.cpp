@@ -31,6 +31,7 @@
 
 #include <dglib/DgZOrderRF.h>
 #include <dglib/DgZOrderSystem.h>
+#include <dglib/DgUtil.h>
 
 const DgHierNdxIntCoord DgZOrderRF::undefZOrderIntCoord(0xffffffffffffffff);
 
@@ -49,8 +50,9 @@ DgZOrderRF::str2add (DgHierNdxIntCoord* add, const char* str, char delimiter) co
     delimStr[1] = '\0';
 
     char* tmpStr = new char[strlen(str) + 1];
+    char* tokPos = 0;
     strcpy(tmpStr, str);
-    char* tok = strtok(tmpStr, delimStr);
+    char* tok = dgg::util::nextToken(tmpStr, delimStr, &tokPos);
 
     // convert to a unit64_t
     uint64_t val = 0;
@@ -71,21 +73,14 @@ DgZOrderRF::str2add (DgHierNdxIntCoord* add, const char* str, char delimiter) co
 DgHierNdxIntCoord
 DgZOrderRF::quantify (const DgQ2DICoord& point) const
 {
-   // use string form to quantify
-   DgHierNdxStringCoord strC = system().pStrRF()->quantify(point);
-   DgHierNdxIntCoord c = system().toIntCoord(strC);
-
-   return c;
+   return system().hierNdxRFS().quantifyInt(point, res());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 DgQ2DICoord
 DgZOrderRF::invQuantify (const DgHierNdxIntCoord& add) const
 {
-   // via string form
-   DgHierNdxStringCoord strC = system().toStringCoord(add);
-   DgQ2DICoord q = system().pStrRF()->invQuantify(strC);
-   return q;
+   return system().hierNdxRFS().invQuantifyInt(add, res());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,7 +26,7 @@
 
 #include <dglib/DgZOrderStringRF.h>
 #include <dglib/DgIVec3D.h>
-#include <dglib/DgRadixString.h>
+#include <dglib/DgHierNdxSystemRFSBase.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 DgZOrderStringRF::DgZOrderStringRF (const DgHierNdxSystemRFBase& sysIn, int resIn,
@@ -46,103 +46,15 @@ DgZOrderStringRF::DgZOrderStringRF (const DgHierNdxSystemRFBase& sysIn, int resI
 DgHierNdxStringCoord
 DgZOrderStringRF::quantify (const DgQ2DICoord& addIn) const
 {
-    std::string qstr = dgg::util::to_string(addIn.quadNum(), 2);
-    std::string addstr = qstr;
-
-    if (effRes() > 0) {
- //dgcout << "** addIn " << addIn << std::endl;
-       DgRadixString rs1(effRadix(), (int) addIn.coord().i(), effRes());
-       DgRadixString rs2(effRadix(), (int) addIn.coord().j(), effRes());
-
- //dgcout << "rs1 " << rs1 << std::endl;
- //dgcout << "rs2 " << rs2 << std::endl;
-
- /*
-    if (IDGG().aperture() == 3) {
-       dgcout << "Class " << ((IDGG().isClassI()) ? "I" : "II") << std::endl;
-    }
- */
-       addstr = addstr +
-           DgRadixString::digitInterleave(rs1, rs2, !((dgg().aperture() == 3)));
-
- //dgcout << "addstr " << addstr << std::endl;
-    // trim last digit if Class II
-       if (aperture() == 3 && !dgg().isClassI() && addstr.length()) {
-          addstr.pop_back();
-       }
- //dgcout << "trimmed " << addstr << std::endl;
-    }
-
-    DgHierNdxStringCoord c;
-    c.setValue(addstr);
-
-   return c;
+    // derive from the integer form
+    return system().toStringCoord(system().hierNdxRFS().quantifyInt(addIn, res()));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 DgQ2DICoord
 DgZOrderStringRF::invQuantify (const DgHierNdxStringCoord& addIn) const
 {
-    std::string addstr = addIn.valString();
-
-    // first get the quad number
-    std::string qstr = addstr.substr(0, 2);
-    if (qstr[0] == '0') // leading 0
-       qstr = qstr.substr(1, 1);
-    int quadNum = std::stoi(qstr);
-
-    int index = 2; // skip the two quad digits
-
-    // the rest is the radix string
-    std::string radStr = addstr.substr(index);
-
-    // split out the interleaved digits
-    std::string radStr1 = "";
-    std::string radStr2 = "";
-
-    if (aperture() == 3) {
-       bool isIdigit = true; // first char is an i digit
-       int lastIdigit = 0;
-       for (const char& digit: radStr) {
-          if (isIdigit) {
-             radStr1 += dgg::util::to_string(digit);
-             lastIdigit = digit - '0';
-          } else
-             radStr2 += dgg::util::to_string(digit);
-
-          isIdigit = !isIdigit;
-       }
-
-       if (!dgg().isClassI()) {
-          // add the last j digit based on the last i digit
-          std::string jDigits[] = { "0", "2", "1" };
-          radStr2 += jDigits[lastIdigit];
-       }
-
-    } else {
-
-       for (const char& digit: radStr) {
-
-          // break out the interleaved digits
-          int d = digit - '0'; // convert to int
-          int c1 = (int) (d / effRadix_);
-
-          int c2 = (d % effRadix_);
-
-          radStr1 += dgg::util::to_string(c1);
-          radStr2 += dgg::util::to_string(c2);
-       }
-    }
-
-    DgRadixString rad1(effRadix_, radStr1);
-    DgRadixString rad2(effRadix_, radStr2);
-
-    //dgcout << "qstr: " << qstr << " rad1: " << rad1 << " rad2: " << rad2 << std::endl;
-
-    DgQ2DICoord q2di(quadNum, DgIVec2D(rad1.value(), rad2.value()));
-    //dgcout << "q2di: " << q2di << std::endl;
-
-    return q2di;
+    return system().hierNdxRFS().invQuantifyInt(system().toIntCoord(addIn), res());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -91,39 +91,30 @@ DgZOrderSystem::DgZOrderSystem (const DgIDGGSBase& dggsIn, bool extModeIntIn, co
 DgHierNdxIntCoord
 DgZOrderSystem::toIntCoord (const DgHierNdxStringCoord& addIn, int gridRes) const
 {
-    std::string addstr = addIn.valString();
+    const std::string addstr = addIn.value();
     if (addstr.size() - 2 > MAX_ZORDER_RES) {
      report("DgZOrderSystem::toIntCoord(): "
         " input resolution exceeds max ZOrder resolution of 30", DgBase::Fatal);
     }
 
-    uint64_t z = 0;
-
-    // first get the quad number and add to the val
-    std::string qstr = addstr.substr(0, 2);
-    if (qstr[0] == '0') // leading 0
-       qstr = qstr.substr(1, 1);
-    int quadNum = std::stoi(qstr);
-    ZORDER_SET_QUADNUM(z, quadNum);
-
-    int index = 2; // skip the two quad digits
-
-    // the rest is the radix string — length must match grid resolution
-    std::string radStr = addstr.substr(index);
-    if ((int) radStr.size() != gridRes) {
+    // the length must match grid resolution
+    int nDigits = (int) addstr.size() - 2;
+    if (nDigits != gridRes) {
        report("DgZOrderSystem::toIntCoord(): Z-order digit string must have "
               "exactly gridRes radix digits after the base cell (2 digits); "
-              "got " + dgg::util::to_string((int) radStr.size()) +
+              "got " + dgg::util::to_string(nDigits) +
               " expected " + dgg::util::to_string(gridRes),
               DgBase::Fatal);
     }
 
-    int r = 1;
-    for (const char& digit: radStr) {
-       int d = digit - '0'; // convert to int
-       ZORDER_SET_INDEX_DIGIT(z, r, d);
-       r++;
-    }
+    uint64_t z = 0;
+
+    // the two quad digits
+    int quadNum = (addstr[0] - '0') * 10 + (addstr[1] - '0');
+    ZORDER_SET_QUADNUM(z, quadNum);
+
+    for (int r = 1; r <= nDigits; r++)
+       ZORDER_SET_INDEX_DIGIT(z, r, addstr[r + 1] - '0');
 
     DgHierNdxIntCoord coord;
     coord.setValue(z);
@@ -138,16 +129,12 @@ DgZOrderSystem::toStringCoord (const DgHierNdxIntCoord& addIn, int gridRes) cons
     uint64_t z = addIn.value();
 
     int quadNum = ZORDER_GET_QUADNUM(z);
-    std::string s = dgg::util::to_string(quadNum, 2);
-
-    for (int r = 1; r <= gridRes; r++) {
-       // get the integer digit
-       char d = ZORDER_GET_INDEX_DIGIT(z, r);
-       // convert to char
-       d += '0';
-       // append to index string
-       s += d;
-    }
+    std::string s(gridRes + 2, '0');
+    s[0] = (char) ('0' + quadNum / 10);
+    s[1] = (char) ('0' + quadNum % 10);
+
+    for (int r = 1; r <= gridRes; r++)
+       s[r + 1] = (char) ('0' + ZORDER_GET_INDEX_DIGIT(z, r));
 
     DgHierNdxStringCoord zStr;
     zStr.setValue(s);
@@ -155,6 +142,111 @@ DgZOrderSystem::toStringCoord (const DgHierNdxIntCoord& addIn, int gridRes) cons
     return zStr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+DgHierNdxIntCoord
+DgZOrderSystem::quantifyInt (const DgQ2DICoord& add, int gridRes) const
+{
+    const DgIDGGBase& grid = dgg(gridRes);
+
+    // aperture 3 interleaves the base 3 i and j digits of the Class I
+    // resolutions, dropping the last j digit at Class II resolutions;
+    // otherwise each digit combines the radix i and j digits
+    const bool ap3 = (grid.aperture() == 3);
+    const int effRadix = (ap3) ? 3 : grid.radix();
+    const int effRes = (ap3) ? (gridRes + 1) / 2 : gridRes;
+
+    int nDigits = (ap3) ? 2 * effRes : effRes;
+    if (ap3 && effRes > 0 && !grid.isClassI())
+       nDigits--;
+
+    if (nDigits != gridRes || gridRes > MAX_ZORDER_RES) {
+       report("DgZOrderSystem::quantifyInt(): invalid ZORDER resolution " +
+              dgg::util::to_string(gridRes), DgBase::Fatal);
+    }
+
+    long long int i = add.coord().i();
+    long long int j = add.coord().j();
+    if (i < 0 || j < 0) {
+       report("DgZOrderSystem::quantifyInt(): negative coordinate",
+              DgBase::Fatal);
+    }
+
+    uint64_t z = 0;
+    ZORDER_SET_QUADNUM(z, add.quadNum());
+
+    // least significant digits first
+    for (int k = effRes - 1; k >= 0; k--) {
+       const int di = (int) (i % effRadix);
+       const int dj = (int) (j % effRadix);
+       i /= effRadix;
+       j /= effRadix;
+
+       if (ap3) {
+          const int r = 2 * k + 1;
+          ZORDER_SET_INDEX_DIGIT(z, r, di);
+          if (r < nDigits)
+             ZORDER_SET_INDEX_DIGIT(z, r + 1, dj);
+       } else
+          ZORDER_SET_INDEX_DIGIT(z, k + 1, di * effRadix + dj);
+    }
+
+    if (i || j) {
+       report("DgZOrderSystem::quantifyInt(): coordinate out of range for "
+              "resolution " + dgg::util::to_string(gridRes), DgBase::Fatal);
+    }
+
+    DgHierNdxIntCoord coord;
+    coord.setValue(z);
+
+    return coord;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+DgQ2DICoord
+DgZOrderSystem::invQuantifyInt (const DgHierNdxIntCoord& addIn, int gridRes) const
+{
+    const DgIDGGBase& grid = dgg(gridRes);
+    uint64_t z = addIn.value();
+
+    int quadNum = ZORDER_GET_QUADNUM(z);
+
+    long long int i = 0;
+    long long int j = 0;
+    if (grid.aperture() == 3) {
+       int lastIdigit = 0;
+       for (int r = 1; r <= gridRes; r++) {
+          const int d = ZORDER_GET_INDEX_DIGIT(z, r);
+          if (d > 2) {
+             report("DgZOrderSystem::invQuantifyInt(): invalid ZORDER digit "
+                    "in index " + addIn.valString(), DgBase::Fatal);
+          }
+
+          if (r % 2) {
+             i = i * 3 + d;
+             lastIdigit = d;
+          } else
+             j = j * 3 + d;
+       }
+
+       if (!grid.isClassI()) {
+          // add the last j digit based on the last i digit
+          static const int jDigits[] = { 0, 2, 1 };
+          j = j * 3 + jDigits[lastIdigit];
+       }
+
+    } else {
+
+       const int effRadix = grid.radix();
+       for (int r = 1; r <= gridRes; r++) {
+          const int d = ZORDER_GET_INDEX_DIGIT(z, r);
+          i = i * effRadix + d / effRadix;
+          j = j * effRadix + d % effRadix;
+       }
+    }
+
+    return DgQ2DICoord(quadNum, DgIVec2D(i, j));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void
 DgZOrderSystem::setAddNdxParent (const DgResAdd<DgHierNdx>& add,